@@ -1,12 +1,23 @@
 #pragma once
 
 #include "core/Config.hpp"
+#include "core/DataService.hpp"
+#include "core/RowOrder.hpp"
 #include "database/DatabaseManager.hpp"
 #include "database/repositories/RoomRepository.hpp"
 #include "database/repositories/GuestRepository.hpp"
 #include "database/repositories/BookingRepository.hpp"
+#include "database/repositories/DashboardRepository.hpp"
+#include "utils/FramePacer.hpp"
+#include "utils/Profiler.hpp"
+#include "utils/StartupTimeline.hpp"
+#include <atomic>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 // Forward declarations
 struct GLFWwindow;
@@ -31,39 +42,134 @@ private:
 
     // Core systems
     Config config;
+    StartupTimeline startupTimeline; // clock starts with the application
+    std::atomic<bool> windowReady{false}; // GLFW may be woken from other threads
+    std::unique_ptr<Profiler> profiler; // outlives the database calls it times
     std::unique_ptr<DatabaseManager> dbManager;
 
+    // In-memory room availability, shared by the room and booking repositories
+    std::unique_ptr<AvailabilityIndex> availabilityIndex;
+
+    // In-memory guest search, maintained by the guest repository
+    std::unique_ptr<GuestSearchIndex> guestSearchIndex;
+
     // Repositories
     std::unique_ptr<RoomRepository> roomRepo;
     std::unique_ptr<GuestRepository> guestRepo;
     std::unique_ptr<BookingRepository> bookingRepo;
+    std::unique_ptr<DashboardRepository> dashboardRepo;
+
+    // Background loader for view data
+    std::unique_ptr<DataService> dataService;
+
+    // Idle detection, frame cap and frame statistics for the main loop
+    std::unique_ptr<FramePacer> framePacer;
+    uint64_t drawnVersion = 0; // snapshot version on screen
+    ConnectionState drawnConnectionState = ConnectionState::Connected;
+    bool showFrameStats = false;
+    bool showProfiler = false;
+    std::string selectedQuery; // profiler series shown in detail
 
     // Application state
     bool running = false;
     int currentView = 0; // 0=Dashboard, 1=Rooms, 2=Guests, 3=Bookings
 
+    // Sorts large tables across cores
+    std::unique_ptr<ThreadPool> sortPool;
+
+    // Rows of a list view in display order (positions in table), with the
+    // inputs they were computed from
+    template <typename T>
+    struct ListRows {
+        std::shared_ptr<const TableData<T>> table;
+        std::string text;
+        int status = 0;
+        std::vector<SortKey> sortKeys;
+        std::vector<uint32_t> rows;
+
+        // Ranks of the columns sorted on so far, by column, for table
+        std::vector<ColumnRanks> columnRanks;
+    };
+
+    // Filter and sort controls of a list view
+    struct ListControls {
+        char text[64] = "";
+        std::vector<Completion> suggestions;
+        bool suggestionsHovered = false;
+        int status = 0; // 0 = any, otherwise the view's status option
+        std::vector<SortKey> sortKeys; // most significant first; empty = table order
+    };
+
+    // Rows are filtered and sorted on a background thread. The view keeps
+    // drawing the last result, and the table it indexes, until the next
+    // one lands.
+    template <typename T>
+    struct ListView : ListControls {
+        ListRows<T> shown;
+        std::future<ListRows<T>> pending;
+    };
+    ListView<Room> roomView;
+    ListView<Guest> guestView;
+    ListView<Booking> bookingView; // after sortPool: pending jobs use it
+
+    // Whether a table row passes a view's text and status filters, and what
+    // it sorts by in a column
+    template <typename T>
+    using RowFilter = bool (*)(const TableData<T>& table, size_t row, std::string_view text, int status);
+    template <typename T>
+    using RowSortValue = SortValue (*)(const TableData<T>& table, int column, size_t row);
+
     // Initialization helpers
+    void initLogging();
     bool initWindow();
     bool initImGui();
     bool initDatabase();
     bool initRepositories();
+    void warmUp();
+    void initAvailabilityIndex(CivilDate today, const std::vector<RoomType>& roomTypes,
+                               const std::vector<Room>& rooms, const std::vector<Booking>& activeBookings);
+    void initGuestSearchIndex();
+    void maintainAvailabilityIndex();
 
     // Main loop
     void processEvents();
     void update();
     void render();
     void renderUI();
+    void installWakeCallbacks();
 
     // UI rendering
     void renderMenuBar();
     void renderSidebar();
     void renderMainContent();
+    void renderFrameStats();
+    void renderProfiler();
 
     // View renderers
-    void renderDashboard();
-    void renderRoomsView();
-    void renderGuestsView();
-    void renderBookingsView();
+    void renderDashboard(const DataSnapshot& data);
+    void renderRoomsView(const DataSnapshot& data);
+    void renderGuestsView(const DataSnapshot& data);
+    void renderBookingsView(const DataSnapshot& data);
+
+    // Filter input with a suggestion list under it while it is being edited
+    void renderFilterInput(const char* id, const char* hint, ListControls& view,
+                           const std::function<std::vector<Completion>(std::string_view)>& complete);
+    // Status drop-down; options[0] is the "any" entry
+    static void renderStatusFilter(const char* id, ListControls& view, const char* const options[],
+                                   int optionCount);
+    // Pick up a changed sort order from the current table's headers
+    static void readSortSpecs(ListControls& view);
+    // Take a finished recompute, and start another when the table (its
+    // generation), a filter or the sort order no longer match what is shown
+    template <typename T>
+    void updateRows(ListView<T>& view, const std::shared_ptr<const TableData<T>>& table,
+                    RowFilter<T> matches, RowSortValue<T> valueOf);
+    // Filter (if refilter) and sort job.rows; runs on a background thread
+    template <typename T>
+    static ListRows<T> computeRows(ThreadPool& pool, ListRows<T> job, bool refilter,
+                                   RowFilter<T> matches, RowSortValue<T> valueOf);
+    // Wait for background row updates (before the sort pool goes away)
+    void finishRowUpdates();
 };
 
 } // namespace HotelManagement
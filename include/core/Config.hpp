@@ -46,6 +46,11 @@ public:
     std::string getDatabaseUser() const;
     std::string getDatabasePassword() const;
     std::string getDatabaseSSLMode() const;
+    int getMaxConnections() const;
+    int getConnectionTimeout() const; // seconds
+    int getHealthCheckIntervalMs() const;
+    int getReconnectMaxBackoffMs() const;
+    int getReadRetries() const;
 
     // Build connection string for libpqxx
     std::string buildConnectionString() const;
@@ -57,10 +62,32 @@ public:
     bool isFullscreen() const;
     bool isVSyncEnabled() const;
     int getMSAASamples() const;
+    int getTargetFps() const; // 0 = uncapped
+    bool isIdleWaitEnabled() const;
+    int getIdleWakeupMs() const;
+    bool isMetricsWindowEnabled() const;
+    int getDataRefreshIntervalMs() const;
+    int getAvailabilityHorizonDays() const;
+    bool isGuestSearchIndexEnabled() const;
+
+    // Entity cache memory budgets
+    int getGuestCacheMb() const;
+    int getBookingCacheMb() const;
+    int getRoomCacheMb() const;
+    int getRoomTypeCacheMb() const;
 
     // Logging settings
     std::string getLogLevel() const;
     std::string getLogFile() const;
+    bool isAsyncLoggingEnabled() const;
+    int getLogQueueSize() const;
+    int getLogFlushIntervalMs() const;
+    std::string getLogOverflowPolicy() const; // "block" or "drop"
+    bool isLogRotationEnabled() const;
+    int getMaxLogSizeMb() const;
+    bool isDailyLogRotationEnabled() const;
+    int getMaxLogFiles() const;
+    bool isLogCompressionEnabled() const;
 
     // Clear all configuration
     void clear();
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "utils/Csv.hpp"
+#include "utils/MappedFile.hpp"
+#include "utils/ThreadPool.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <optional>
+#include <functional>
+#include <future>
+#include <chrono>
+#include <algorithm>
+#include <exception>
+
+namespace HotelManagement {
+
+struct ImportOptions {
+    size_t chunkBytes = 4 * 1024 * 1024; // CSV bytes parsed per task
+    size_t batchSize = 10000;            // valid rows handed to the sink at once
+    size_t threads = 0;                  // parser threads, 0 = hardware threads
+    size_t maxErrorReports = 1000;       // rejected rows reported (all are counted)
+};
+
+struct ImportRowError {
+    size_t line = 0; // line the record starts on
+    std::string message;
+};
+
+struct ImportResult {
+    bool completed = false; // false if the file was unreadable or a batch failed
+    std::string failure;
+    size_t rowsRead = 0;
+    size_t rowsImported = 0;
+    size_t rowsRejected = 0;
+    std::vector<ImportRowError> errors; // in file order
+    double seconds = 0.0;
+
+    double getRowsPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(rowsRead) / seconds : 0.0;
+    }
+};
+
+// Parallel CSV ingestion. The file is memory-mapped and cut into chunks on
+// record boundaries; a thread pool parses and validates chunks while the
+// calling thread hands valid rows to the sink in file order, batchSize rows
+// at a time. At most two chunks per thread are in flight and consumed pages
+// are released, so memory stays flat regardless of file size.
+template<typename Record>
+class CsvImporter {
+public:
+    // Converts one record; on failure returns std::nullopt and sets error.
+    // Called concurrently from pool threads.
+    using RowParser = std::function<std::optional<Record>(const std::vector<std::string>& fields,
+                                                          std::string& error)>;
+
+    // Builds the row parser from the header; returns an empty parser and
+    // sets error if required columns are missing
+    using ParserFactory = std::function<RowParser(const CsvHeader& header, std::string& error)>;
+
+    // Stores a batch; false aborts the import
+    using BatchSink = std::function<bool(const std::vector<Record>& batch)>;
+
+    explicit CsvImporter(const ImportOptions& opts = ImportOptions()) : options(opts) {
+        options.chunkBytes = std::max<size_t>(options.chunkBytes, 4096);
+        options.batchSize = std::max<size_t>(options.batchSize, 1);
+    }
+
+    ImportResult run(const std::string& path, const ParserFactory& makeParser, const BatchSink& sink) const {
+        const auto started = std::chrono::steady_clock::now();
+        ImportResult result;
+        auto finish = [&]() {
+            result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+            return result;
+        };
+
+        MappedFile file;
+        if (!file.open(path)) {
+            result.failure = file.getLastError();
+            return finish();
+        }
+
+        std::string_view data = file.view();
+        size_t start = data.substr(0, 3) == "\xEF\xBB\xBF" ? 3 : 0; // UTF-8 BOM
+
+        CsvBufferReader headerReader(data.substr(start));
+        std::vector<std::string> names;
+        if (!headerReader.next(names)) {
+            result.failure = "Empty file: " + path;
+            return finish();
+        }
+
+        std::string error;
+        const RowParser parseRow = makeParser(CsvHeader(names), error);
+        if (!parseRow) {
+            result.failure = error;
+            return finish();
+        }
+
+        size_t pos = start + headerReader.getOffset();
+        size_t line = 1 + static_cast<size_t>(std::count(data.begin(), data.begin() + pos, '\n'));
+        size_t released = 0;
+
+        std::vector<Record> batch;
+        batch.reserve(options.batchSize);
+        auto flush = [&]() {
+            if (batch.empty()) {
+                return true;
+            }
+            if (!sink(batch)) {
+                result.failure = "Failed to store a batch of " + std::to_string(batch.size()) + " rows";
+                return false;
+            }
+            result.rowsImported += batch.size();
+            batch.clear();
+            return true;
+        };
+
+        try {
+            // Declared after everything its tasks reference, so it drains first
+            ThreadPool pool(options.threads);
+            const size_t maxInFlight = pool.size() * 2;
+            std::deque<std::future<Chunk>> inFlight;
+
+            auto drainOne = [&]() {
+                Chunk chunk = inFlight.front().get();
+                inFlight.pop_front();
+
+                result.rowsRead += chunk.rowsRead;
+                result.rowsRejected += chunk.rowsRejected;
+                for (auto& rowError : chunk.errors) {
+                    if (result.errors.size() >= options.maxErrorReports) {
+                        break;
+                    }
+                    result.errors.push_back(std::move(rowError));
+                }
+
+                for (auto& record : chunk.records) {
+                    batch.push_back(std::move(record));
+                    if (batch.size() >= options.batchSize && !flush()) {
+                        return false;
+                    }
+                }
+
+                file.release(released, chunk.endOffset - released);
+                released = chunk.endOffset;
+                return true;
+            };
+
+            while (pos < data.size()) {
+                size_t lines = 0;
+                size_t end = CsvBufferReader::findRecordEnd(data, pos, pos + options.chunkBytes, lines);
+                std::string_view slice = data.substr(pos, end - pos);
+                size_t firstLine = line;
+
+                inFlight.push_back(pool.submit([this, slice, firstLine, end, &parseRow]() {
+                    return parseChunk(slice, firstLine, end, parseRow);
+                }));
+                pos = end;
+                line += lines;
+
+                if (inFlight.size() >= maxInFlight && !drainOne()) {
+                    return finish();
+                }
+            }
+            while (!inFlight.empty()) {
+                if (!drainOne()) {
+                    return finish();
+                }
+            }
+            if (!flush()) {
+                return finish();
+            }
+        } catch (const std::exception& e) {
+            result.failure = e.what();
+            return finish();
+        }
+
+        result.completed = true;
+        return finish();
+    }
+
+private:
+    struct Chunk {
+        std::vector<Record> records;
+        std::vector<ImportRowError> errors;
+        size_t rowsRead = 0;
+        size_t rowsRejected = 0;
+        size_t endOffset = 0;
+    };
+
+    ImportOptions options;
+
+    Chunk parseChunk(std::string_view slice, size_t firstLine, size_t endOffset,
+                     const RowParser& parseRow) const {
+        Chunk chunk;
+        chunk.endOffset = endOffset;
+
+        CsvBufferReader reader(slice, firstLine);
+        std::vector<std::string> fields;
+        std::string error;
+        while (reader.next(fields)) {
+            if (fields.size() == 1 && fields[0].empty()) {
+                continue; // blank line
+            }
+            chunk.rowsRead++;
+
+            error.clear();
+            std::optional<Record> record = parseRow(fields, error);
+            if (record.has_value()) {
+                chunk.records.push_back(std::move(record.value()));
+                continue;
+            }
+
+            chunk.rowsRejected++;
+            if (chunk.errors.size() < options.maxErrorReports) {
+                chunk.errors.push_back(ImportRowError{reader.getLineNumber(), error});
+            }
+        }
+        return chunk;
+    }
+};
+
+} // namespace HotelManagement
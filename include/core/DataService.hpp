@@ -0,0 +1,118 @@
+#pragma once
+
+#include "database/repositories/RoomRepository.hpp"
+#include "database/repositories/GuestRepository.hpp"
+#include "database/repositories/BookingRepository.hpp"
+#include "database/repositories/DashboardRepository.hpp"
+#include "utils/TableText.hpp"
+#include <functional>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+
+namespace HotelManagement {
+
+// One table's entities and their cells, formatted by the worker. Snapshots
+// share a table until a notification says its rows changed.
+template <typename T>
+struct TableData {
+    explicit TableData(size_t columnCount) : rows(columnCount) {}
+
+    std::vector<T> entities;
+    TableText rows; // cells in the same order as entities
+    uint64_t generation = 0; // new for every reload whose rows differ
+};
+
+// Immutable view data published by DataService
+struct DataSnapshot {
+    // number, floor, type id, status
+    std::shared_ptr<const TableData<Room>> rooms = std::make_shared<TableData<Room>>(4);
+    // id, name, email, phone, VIP
+    std::shared_ptr<const TableData<Guest>> guests = std::make_shared<TableData<Guest>>(5);
+    // id, guest id, room id, check-in, check-out, status
+    std::shared_ptr<const TableData<Booking>> bookings = std::make_shared<TableData<Booking>>(6);
+
+    DashboardStats stats;
+    uint64_t version = 0;
+    std::chrono::system_clock::time_point refreshedAt;
+    double loadTimeMs = 0.0;
+};
+
+// Loads view data on a worker thread so the render loop never waits on the
+// database. The worker builds a complete snapshot off to the side and then
+// swaps it in; readers keep whatever snapshot they grabbed for the frame.
+// Notifications drive the refreshes: a *_changed or *_inserted NOTIFY wakes
+// the worker, which queries only the tables named since their last load.
+// The dashboard counts are also polled every refreshInterval (they move
+// with the date). Snapshots are published only when something differs.
+class DataService {
+public:
+    DataService(DatabaseManager& dbManager, RoomRepository& roomRepo, GuestRepository& guestRepo,
+                BookingRepository& bookingRepo, DashboardRepository& dashboardRepo,
+                std::chrono::milliseconds refreshInterval);
+    ~DataService();
+
+    // Start/stop the background worker
+    void start();
+    void stop();
+
+    // Wake the worker for an immediate refresh (e.g. after a write)
+    void requestRefresh();
+
+    // Called on the worker thread after each publish, i.e. only when the
+    // data changed; set before start()
+    void setPublishListener(std::function<void()> listener);
+
+    // Called on the worker thread before each refresh, for upkeep that must
+    // stay off the render thread; set before start()
+    void setRefreshHook(std::function<void()> hook);
+
+    // Latest published snapshot; never null once constructed
+    std::shared_ptr<const DataSnapshot> getSnapshot() const;
+
+    DataService(const DataService&) = delete;
+    DataService& operator=(const DataService&) = delete;
+
+private:
+    // Bit per table in staleTables
+    enum TableBit : unsigned {
+        RoomsTable = 1u,
+        GuestsTable = 2u,
+        BookingsTable = 4u,
+        AllTables = RoomsTable | GuestsTable | BookingsTable
+    };
+
+    DatabaseManager& dbManager;
+    RoomRepository& roomRepo;
+    GuestRepository& guestRepo;
+    BookingRepository& bookingRepo;
+    DashboardRepository& dashboardRepo;
+    const std::chrono::milliseconds refreshInterval;
+
+    std::thread worker;
+    std::mutex workerMutex;
+    std::condition_variable wakeUp;
+    bool stopRequested = false;
+    bool refreshRequested = false;
+    unsigned staleTables = AllTables; // reload on the next refresh
+    std::vector<int> handlerIds;
+    std::function<void()> publishListener;
+    std::function<void()> refreshHook;
+
+    mutable std::mutex snapshotMutex;
+    std::shared_ptr<const DataSnapshot> current;
+    uint64_t nextVersion = 1;
+    uint64_t nextGeneration = 1; // worker thread only
+
+    void markStale(unsigned tables);
+    void workerLoop();
+    // nullptr when nothing differs from the current snapshot
+    std::shared_ptr<DataSnapshot> loadSnapshot();
+    void publish(std::shared_ptr<DataSnapshot> snapshot);
+};
+
+} // namespace HotelManagement
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "core/CsvImporter.hpp"
+#include "database/models/Guest.hpp"
+#include "database/models/Room.hpp"
+#include "database/models/Booking.hpp"
+
+namespace HotelManagement {
+
+// CsvImporter row parsers for the importable tables. Columns are matched by
+// their database names; each row is checked with Validators and the table's
+// CHECK constraints so bad rows are reported instead of failing a batch.
+class ImportParsers {
+public:
+    static CsvImporter<Guest>::RowParser guests(const CsvHeader& header, std::string& error);
+    static CsvImporter<Room>::RowParser rooms(const CsvHeader& header, std::string& error);
+    static CsvImporter<Booking>::RowParser bookings(const CsvHeader& header, std::string& error);
+};
+
+} // namespace HotelManagement
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "database/repositories/BookingRepository.hpp"
+#include "database/repositories/RoomRepository.hpp"
+#include "utils/CivilDate.hpp"
+#include <vector>
+
+namespace HotelManagement {
+
+// End-of-day close for one business date: the night's figures plus the
+// exceptions the front desk has to resolve before the next day.
+struct NightAuditReport {
+    CivilDate businessDate;
+
+    int totalRooms = 0;
+    int roomsOccupied = 0; // in-house stays covering the night
+    int arrivals = 0;      // stays that started on the date and were checked in
+    int departures = 0;    // stays that ended on the date and were checked out
+    double roomRevenue = 0.0; // each in-house stay's total spread over its nights
+
+    std::vector<Booking> noShows;           // pending or confirmed, arrival due before the date
+    std::vector<Booking> overdueDepartures; // checked in, departure date passed
+    std::vector<int> occupiedWithoutStay;   // rooms marked occupied with nobody checked in
+    std::vector<int> stayInFreeRoom;        // rooms with a guest checked in but not marked occupied
+    size_t noShowsCancelled = 0;
+
+    double getOccupancyRate() const {
+        return totalRooms > 0 ? static_cast<double>(roomsOccupied) / totalRooms : 0.0;
+    }
+};
+
+// Rooms sold and revenue for one night
+struct OccupancyDay {
+    CivilDate date;
+    int roomsSold = 0;
+    double roomRevenue = 0.0;
+};
+
+class NightAudit {
+public:
+    // Audit the night of businessDate in one pass over bookings and rooms.
+    // With cancelNoShows the no-shows found are cancelled afterwards; guests
+    // due on businessDate itself are never counted as no-shows.
+    static NightAuditReport run(BookingRepository& bookings, RoomRepository& rooms,
+                                CivilDate businessDate, bool cancelNoShows);
+
+    // Nights in [from, to): rooms sold by every booking that is not
+    // cancelled (future nights are the booked forecast)
+    static std::vector<OccupancyDay> occupancy(BookingRepository& bookings, CivilDate from, CivilDate to);
+};
+
+} // namespace HotelManagement
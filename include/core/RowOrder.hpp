@@ -0,0 +1,43 @@
+#pragma once
+
+#include "utils/ThreadPool.hpp"
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace HotelManagement {
+
+// One column of a table's sort order
+struct SortKey {
+    int column = 0;
+    bool descending = false;
+
+    bool operator==(const SortKey&) const = default;
+};
+
+// What a row sorts by in one column; numbers sort before strings. Strings
+// must outlive the ranking.
+using SortValue = std::variant<int64_t, std::string_view>;
+
+// Dense rank of every row by one column: equal values share a rank, and
+// ranks run 0..distinct-1 in ascending order
+struct ColumnRanks {
+    std::vector<uint32_t> rank; // by row
+    uint32_t distinct = 0;
+};
+
+// Rank rowCount rows by valueOf(row). Values are read once, in row order,
+// and sorted as a compact array rather than through the rows.
+ColumnRanks rankColumn(ThreadPool& pool, size_t rowCount, const std::function<SortValue(size_t)>& valueOf);
+
+// Sort rows (row numbers) by the keys, most significant first, using the
+// ranks of each key's column (ranks[i] belongs to keys[i]). Ties keep row
+// number order. When the keys' ranks fit in 32 bits together they are
+// packed with the row number into one integer per row and sorted as such;
+// otherwise rows are sorted by comparing rank arrays.
+void sortRows(ThreadPool& pool, std::vector<uint32_t>& rows, const std::vector<SortKey>& keys,
+              const std::vector<const ColumnRanks*>& ranks);
+
+} // namespace HotelManagement
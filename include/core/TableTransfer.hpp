@@ -0,0 +1,26 @@
+#pragma once
+
+#include "core/CsvImporter.hpp"
+#include "database/DatabaseManager.hpp"
+#include <ostream>
+#include <string>
+
+namespace HotelManagement {
+
+// CSV import and export of the guests, rooms and bookings tables for the
+// command-line tools. Files carry a header row with the database column
+// names. Summaries go to out, rejected rows and failures to err.
+class TableTransfer {
+public:
+    static bool isTransferTable(const std::string& table);
+
+    // Parse and validate on a thread pool, store in batches over COPY.
+    // Returns false if the table is unknown or the import did not complete.
+    static bool importCsv(DatabaseManager& db, const std::string& table, const std::string& file,
+                          const ImportOptions& options, std::ostream& out, std::ostream& err);
+
+    static bool exportCsv(DatabaseManager& db, const std::string& table, const std::string& file,
+                          std::ostream& out, std::ostream& err);
+};
+
+} // namespace HotelManagement
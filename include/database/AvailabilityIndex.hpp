@@ -0,0 +1,152 @@
+#pragma once
+
+#include "database/models/Room.hpp"
+#include "database/models/RoomType.hpp"
+#include "database/models/Booking.hpp"
+#include "utils/CivilDate.hpp"
+#include "utils/CompletionIndex.hpp"
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+#include <shared_mutex>
+#include <cstdint>
+
+namespace HotelManagement {
+
+// One candidate stay [startDate, endDate) in a batched availability search
+struct AvailabilityQuery {
+    std::string startDate;
+    std::string endDate;
+    int roomTypeId = 0;   // 0 = any room type
+    int minOccupancy = 0; // guests the room type must hold
+};
+
+// In-memory room occupancy over a fixed window of days.
+//
+// Each day in the window owns a packed bitset with one bit per room slot; a set
+// bit means the room is held by a booking that is not cancelled or checked out
+// (the same rule the SQL availability queries use). A stay [start, end) is free
+// for a room when its bit is clear on every night of the stay.
+//
+// Queries that fall outside the window, or arrive while the index is
+// invalidated, return std::nullopt so the caller can fall back to the database. Row widths are padded to OccupancyKernel's vector
+// width so searches AND whole rows with SIMD. Room numbers also feed a
+// CompletionIndex for autocomplete.
+class AvailabilityIndex {
+public:
+    explicit AvailabilityIndex(int horizonDays = 730);
+    ~AvailabilityIndex() = default;
+
+    // Replace the index contents. origin is the first day covered. Changes
+    // recorded since beginRebuild() are replayed on top of the new contents.
+    bool rebuild(CivilDate origin,
+                 const std::vector<RoomType>& roomTypes,
+                 const std::vector<Room>& rooms,
+                 const std::vector<Booking>& bookings);
+
+    bool isLoaded() const;
+
+    // Drop the contents after a change the index cannot follow row by row
+    // (TRUNCATE, a large import, missed notifications); queries go to the
+    // database until the next rebuild
+    void invalidate();
+
+    // Call before loading the rows for rebuild(): changes arriving from here
+    // on may be missing from those rows, so they are kept and replayed
+    void beginRebuild();
+
+    // Slide the window forward so it starts at origin; days entering the
+    // window are marked from the stays already held
+    void advanceTo(CivilDate origin);
+
+    // Keep in sync with repository writes and row-change notifications
+    void upsertRoomType(const RoomType& roomType);
+    void upsertRoom(const Room& room);
+    void updateRoomStatus(int roomId, RoomStatus status);
+    void removeRoom(int roomId);
+    void upsertBooking(const Booking& booking);
+    void removeBooking(int bookingId);
+
+    // Availability for a stay [startDate, endDate)
+    std::optional<bool> isRoomAvailable(int roomId, const std::string& startDate,
+                                        const std::string& endDate) const;
+
+    // Rooms with status 'available' and no overlapping booking, sorted by id
+    std::optional<std::vector<int>> getAvailableRoomIds(const std::string& startDate,
+                                                        const std::string& endDate) const;
+
+    // Answer many candidate stays under one lock. Results line up with the
+    // queries; std::nullopt marks a query the index cannot answer.
+    std::vector<std::optional<std::vector<int>>> findAvailableRooms(
+        const std::vector<AvailabilityQuery>& queries) const;
+
+    // Room numbers starting with prefix, in text order. Returns std::nullopt when
+    // the index is not loaded.
+    std::optional<std::vector<Completion>> completeRoomNumber(std::string_view prefix, size_t limit) const;
+
+    // Window covered by the index [first, end)
+    CivilDate getFirstDate() const;
+    CivilDate getEndDate() const;
+
+    AvailabilityIndex(const AvailabilityIndex&) = delete;
+    AvailabilityIndex& operator=(const AvailabilityIndex&) = delete;
+
+private:
+    struct Stay {
+        int roomId = 0;
+        int firstDay = 0; // inclusive, days since epoch
+        int endDay = 0;   // exclusive
+    };
+
+    const int horizonDays;
+
+    mutable std::shared_mutex indexMutex;
+    bool loaded = false;
+    bool rebuilding = false;
+    std::vector<std::function<void()>> pendingChanges; // recorded while rebuilding
+    int originDay = 0;
+    size_t wordsPerDay = 0;
+
+    // Day-major occupancy: occupied[day * wordsPerDay + slot / 64]
+    std::vector<uint64_t> occupied;
+    // Rooms whose current status is 'available'
+    std::vector<uint64_t> availableMask;
+    // Rooms of each room type, and each type's capacity
+    std::unordered_map<int, std::vector<uint64_t>> roomTypeMasks;
+    std::unordered_map<int, int> maxOccupancyByType;
+
+    std::unordered_map<int, size_t> slotByRoomId;
+    std::vector<int> roomIdBySlot; // 0 = free slot
+    std::vector<int> roomTypeBySlot;
+    std::vector<size_t> freeSlots;
+
+    CompletionIndex roomNumbers; // by room id
+
+    std::unordered_map<int, Stay> staysByBookingId;
+    std::unordered_map<int, std::vector<int>> bookingIdsByRoom;
+
+    // Unlocked helpers
+    void apply(std::function<void()> change);
+    void applyRoom(const Room& room);
+    void applyRoomRemoval(int roomId);
+    void applyBooking(const Booking& booking);
+    size_t slotFor(int roomId);
+    void growSlots(size_t minSlots);
+    void setRoomStatus(size_t slot, RoomStatus status);
+    void setRoomType(size_t slot, int roomTypeId);
+    std::vector<uint64_t> candidateMask(int roomTypeId, int minOccupancy) const;
+    std::vector<int> searchWindow(std::vector<uint64_t> candidates, int firstIndex, int endIndex) const;
+    void addStay(int bookingId, const Stay& stay);
+    void dropStay(int bookingId);
+    void markDays(size_t slot, int firstDay, int endDay);
+    bool toWindow(const std::string& startDate, const std::string& endDate,
+                  int& firstIndex, int& endIndex) const;
+
+    static bool blocksRoom(BookingStatus status);
+    static Stay toStay(const Booking& booking);
+};
+
+} // namespace HotelManagement
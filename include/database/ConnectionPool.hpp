@@ -0,0 +1,120 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <pqxx/pqxx>
+
+namespace HotelManagement {
+
+class StatementRegistry;
+
+// A pooled connection and the per-session state that must be rebuilt on reconnect
+struct PooledConnection {
+    std::unique_ptr<pqxx::connection> connection;
+    size_t preparedStatements = 0;
+};
+
+// Snapshot of connection pool usage
+struct PoolStats {
+    size_t maxConnections = 0;
+    size_t openConnections = 0;
+    size_t inUse = 0;
+    size_t peakInUse = 0;
+    size_t waiters = 0;
+    uint64_t totalLeases = 0;
+    uint64_t timeouts = 0;
+    double totalWaitMs = 0.0;
+    double maxWaitMs = 0.0;
+
+    double averageWaitMs() const {
+        return totalLeases > 0 ? totalWaitMs / static_cast<double>(totalLeases) : 0.0;
+    }
+};
+
+class ConnectionPool;
+
+// RAII handle to a pooled connection, returned to the pool when destroyed
+class ConnectionLease {
+public:
+    ConnectionLease() = default;
+    ~ConnectionLease();
+
+    ConnectionLease(ConnectionLease&& other) noexcept = default;
+    ConnectionLease& operator=(ConnectionLease&& other) noexcept;
+
+    ConnectionLease(const ConnectionLease&) = delete;
+    ConnectionLease& operator=(const ConnectionLease&) = delete;
+
+    pqxx::connection& operator*() const { return *connection->connection; }
+    pqxx::connection* operator->() const { return connection->connection.get(); }
+    explicit operator bool() const { return connection != nullptr; }
+
+    // Return the connection to the pool early
+    void release();
+
+private:
+    friend class ConnectionPool;
+
+    ConnectionLease(std::shared_ptr<ConnectionPool> owner, std::unique_ptr<PooledConnection> conn);
+
+    std::shared_ptr<ConnectionPool> pool;
+    std::unique_ptr<PooledConnection> connection;
+};
+
+// Fixed-capacity pool of PostgreSQL connections.
+// Connections are opened lazily up to maxConnections; callers block for up to
+// leaseTimeout when all of them are leased. Statements from the registry are
+// prepared on each connection before it is handed out.
+class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
+public:
+    ConnectionPool(std::string connectionString, size_t maxConnections,
+                   std::chrono::milliseconds leaseTimeout,
+                   std::shared_ptr<const StatementRegistry> statements = nullptr);
+    ~ConnectionPool();
+
+    // Open the first connection so configuration errors surface immediately
+    void warmUp();
+
+    // Lease a connection, opening a new one if the pool has spare capacity.
+    // Throws std::runtime_error on timeout or if the pool is closed.
+    ConnectionLease acquire();
+
+    // Close idle connections and reject further leases
+    void close();
+
+    // Drop the idle connections after their server went away; new ones
+    // are opened on demand. Returns how many were dropped.
+    size_t discardIdle();
+
+    bool isClosed() const;
+    PoolStats getStats() const;
+
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+private:
+    friend class ConnectionLease;
+
+    void giveBack(std::unique_ptr<PooledConnection> conn);
+    std::unique_ptr<PooledConnection> openConnection();
+    ConnectionLease makeLease(std::unique_ptr<PooledConnection> conn);
+
+    const std::string connectionString;
+    const size_t maxConnections;
+    const std::chrono::milliseconds leaseTimeout;
+    const std::shared_ptr<const StatementRegistry> statements;
+
+    mutable std::mutex poolMutex;
+    std::condition_variable available;
+    std::vector<std::unique_ptr<PooledConnection>> idle;
+    size_t openCount = 0;
+    bool closed = false;
+    PoolStats stats;
+};
+
+} // namespace HotelManagement
@@ -1,22 +1,55 @@
 #pragma once
 
+#include "database/ConnectionPool.hpp"
+#include "database/StatementRegistry.hpp"
+#include "utils/Profiler.hpp"
 #include <string>
 #include <memory>
 #include <mutex>
+#include <chrono>
 #include <functional>
+#include <vector>
+#include <optional>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+#include <source_location>
 #include <pqxx/pqxx>
 
 namespace HotelManagement {
 
+// Called on the listener thread with a NOTIFY payload. An empty payload
+// means notifications may have been missed (the listener reconnected), so
+// anything derived from them should be dropped.
+using NotificationHandler = std::function<void(const std::string& payload)>;
+
+enum class ConnectionState {
+    Disconnected,
+    Connected,
+    Reconnecting // health check failed; leases fail fast until it passes again
+};
+
+// Supervision of the connection (see startHealthChecks)
+struct ReconnectOptions {
+    std::chrono::milliseconds healthCheckInterval{5000};
+    // Reconnect attempts back off exponentially from initialBackoff up to
+    // maxBackoff, each delay randomized so many clients do not retry in step
+    std::chrono::milliseconds initialBackoff{250};
+    std::chrono::milliseconds maxBackoff{30000};
+    int readRetries = 2; // extra attempts for a read whose connection broke
+};
+
 class DatabaseManager {
 public:
-    // Constructor with connection string
-    explicit DatabaseManager(const std::string& connectionString);
+    // Constructor with connection string and pool sizing
+    explicit DatabaseManager(const std::string& connectionString,
+                             size_t maxConnections = 1,
+                             std::chrono::milliseconds leaseTimeout = std::chrono::seconds(30));
 
     // Destructor
     ~DatabaseManager();
 
-    // Connect to database
+    // Connect to database (opens the pool and its first connection)
     bool connect();
 
     // Disconnect from database
@@ -25,58 +58,181 @@ public:
     // Check if connected
     bool isConnected() const;
 
-    // Get connection reference (for repository use)
-    pqxx::connection& getConnection();
+    // Declare named statements; they are prepared on every pooled connection
+    // (including ones opened later) and invoked with txn.exec_prepared(name, ...)
+    void registerStatements(const std::vector<PreparedStatement>& statements);
 
-    // Execute a transaction with automatic commit/rollback
-    template<typename Func>
-    auto executeTransaction(Func&& func) -> decltype(func(std::declval<pqxx::work&>())) {
-        std::lock_guard<std::mutex> lock(dbMutex);
-
-        if (!connection || !connection->is_open()) {
-            throw std::runtime_error("Database not connected");
-        }
-
-        pqxx::work txn(*connection);
+    // Lease a pooled connection (for repository use); returned when the lease is destroyed
+    ConnectionLease acquireConnection();
 
+    // Execute a transaction with automatic commit/rollback. caller names the
+    // repository method in the profiler; leave it defaulted.
+    // Never retried: a lost connection leaves the commit's outcome unknown.
+    template<typename Func>
+    auto executeTransaction(Func&& func, std::source_location caller = std::source_location::current())
+        -> decltype(func(std::declval<pqxx::work&>())) {
+        ScopedQueryTimer timer(profiler.load(std::memory_order_relaxed), caller);
         try {
+            ConnectionLease lease = acquireConnection();
+            pqxx::work txn(*lease);
+
+            // Transaction will automatically rollback if func throws
             auto result = func(txn);
             txn.commit();
             return result;
-        } catch (const std::exception& e) {
-            // Transaction will automatically rollback when txn goes out of scope
+        } catch (const pqxx::broken_connection&) {
+            connectionLost();
             throw;
         }
     }
 
-    // Execute a read-only transaction (potentially more efficient)
+    // Execute a read-only transaction (potentially more efficient). If the
+    // connection breaks, func is run again on a fresh one up to readRetries
+    // times, so it must build its result from scratch each time.
     template<typename Func>
-    auto executeReadTransaction(Func&& func) -> decltype(func(std::declval<pqxx::nontransaction&>())) {
-        std::lock_guard<std::mutex> lock(dbMutex);
+    auto executeReadTransaction(Func&& func, std::source_location caller = std::source_location::current())
+        -> decltype(func(std::declval<pqxx::nontransaction&>())) {
+        ScopedQueryTimer timer(profiler.load(std::memory_order_relaxed), caller);
+        for (int attempt = 0;; attempt++) {
+            try {
+                ConnectionLease lease = acquireConnection();
+                pqxx::nontransaction txn(*lease);
+                return func(txn);
+            } catch (const pqxx::broken_connection& e) {
+                connectionLost();
+                if (!waitToRetryRead(attempt, e)) {
+                    throw;
+                }
+            }
+        }
+    }
 
-        if (!connection || !connection->is_open()) {
-            throw std::runtime_error("Database not connected");
+    // A read that is never retried, for funcs that hand rows to a visitor
+    // as they arrive (a retry would visit them twice)
+    template<typename Func>
+    auto executeReadOnce(Func&& func, std::source_location caller = std::source_location::current())
+        -> decltype(func(std::declval<pqxx::nontransaction&>())) {
+        ScopedQueryTimer timer(profiler.load(std::memory_order_relaxed), caller);
+        try {
+            ConnectionLease lease = acquireConnection();
+            pqxx::nontransaction txn(*lease);
+            return func(txn);
+        } catch (const pqxx::broken_connection&) {
+            connectionLost();
+            throw;
         }
+    }
 
-        pqxx::nontransaction txn(*connection);
-        return func(txn);
+    // Run independent read-only queries in a single network round trip using
+    // pqxx::pipeline. Results are returned in the same order as the queries.
+    std::vector<pqxx::result> executeBatch(const std::vector<std::string>& queries,
+                                           std::source_location caller = std::source_location::current());
+
+    // Stream the rows of a query through a server-side cursor, fetching
+    // batchSize rows at a time so memory stays constant for any table size.
+    // onRow returns false to stop early. Returns the number of rows visited.
+    size_t streamQuery(const std::string& query, size_t batchSize,
+                       const std::function<bool(const pqxx::row&)>& onRow,
+                       std::source_location caller = std::source_location::current());
+
+    // Draw `count` ids from a table's SERIAL id sequence, so bulk COPY
+    // inserts can supply ids up front and report them to the caller
+    static std::vector<int> reserveIds(pqxx::work& txn, const std::string& table, size_t count);
+
+    // Empty model strings are stored as NULL in nullable columns
+    static std::optional<std::string> nullIfEmpty(const std::string& value) {
+        return value.empty() ? std::nullopt : std::optional<std::string>(value);
     }
 
+    // Subscribe to a NOTIFY channel; returns an id for removeNotificationHandler.
+    // Handlers must not add or remove handlers themselves.
+    int addNotificationHandler(const std::string& channel, NotificationHandler handler);
+
+    // Unsubscribe; waits for a running call of the handler to finish
+    void removeNotificationHandler(int handlerId);
+
+    // LISTEN for the subscribed channels on a dedicated connection outside
+    // the pool, dispatching notifications from a background thread
+    void startListener();
+    void stopListener();
+
     // Health check - verify database connection is alive
     bool ping();
 
+    // Ping on a dedicated connection every healthCheckInterval (and at once
+    // when a query loses its connection). On failure the idle pooled
+    // connections are dropped, leases fail fast and the check retries with
+    // backoff; once it passes, the pool reopens connections on demand and
+    // prepares the registered statements on each.
+    void startHealthChecks(const ReconnectOptions& options = {});
+    void stopHealthChecks();
+
+    ConnectionState getConnectionState() const { return connectionState.load(); }
+
+    // Connection pool usage (in-use, waiters, wait times)
+    PoolStats getPoolStats() const;
+
     // Get last error message
     std::string getLastError() const;
 
+    // Time every transaction into the profiler (nullptr to stop); it must
+    // outlive the calls in flight
+    void setProfiler(Profiler* target) { profiler.store(target, std::memory_order_relaxed); }
+
     // Delete copy constructor and assignment operator
     DatabaseManager(const DatabaseManager&) = delete;
     DatabaseManager& operator=(const DatabaseManager&) = delete;
 
 private:
     std::string connectionString;
-    std::unique_ptr<pqxx::connection> connection;
+    size_t maxConnections;
+    std::chrono::milliseconds leaseTimeout;
+
+    std::shared_ptr<StatementRegistry> statementRegistry;
+    std::shared_ptr<ConnectionPool> pool;
     mutable std::mutex dbMutex;
     std::string lastError;
+    std::atomic<Profiler*> profiler{nullptr};
+    std::atomic<ConnectionState> connectionState{ConnectionState::Disconnected};
+
+    struct HandlerEntry {
+        int id;
+        std::string channel;
+        NotificationHandler handler;
+    };
+
+    // Guards handlers; held while dispatching so removal waits for callers
+    std::mutex handlerMutex;
+    std::vector<HandlerEntry> handlers;
+    int nextHandlerId = 1;
+    std::atomic<bool> channelsChanged{false};
+
+    std::thread listenerThread;
+    std::mutex listenerMutex;
+    std::condition_variable listenerWake;
+    bool listenerStopping = false;
+
+    std::thread healthThread;
+    std::mutex healthMutex;
+    std::condition_variable healthWake;
+    bool healthStopping = false;
+    bool healthCheckRequested = false;
+    ReconnectOptions reconnectOptions; // guarded by healthMutex
+    std::atomic<int> readRetries{ReconnectOptions{}.readRetries};
+
+    std::shared_ptr<ConnectionPool> currentPool() const;
+
+    // A query saw its connection break: drop the idle ones (they most
+    // likely broke too) and ask the health checker to look now
+    void connectionLost();
+    // Back off before retry `attempt` of a read; false when out of retries
+    bool waitToRetryRead(int attempt, const pqxx::broken_connection& error);
+    std::chrono::milliseconds reconnectDelay(int attempt);
+    void healthLoop();
+
+    void listenerLoop();
+    void dispatchNotification(const std::string& channel, const std::string& payload);
+    std::vector<std::string> subscribedChannels();
 
     // Helper to log database errors
     void logError(const std::string& error);
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "utils/TinyLfuCache.hpp"
+#include <charconv>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace HotelManagement {
+
+// Used when a repository is constructed without an explicit cache budget
+constexpr size_t DEFAULT_ENTITY_CACHE_BYTES = size_t{16} << 20;
+
+// Heap bytes owned by a string (none while it fits the small-string buffer)
+inline size_t heapBytes(const std::string& text) {
+    static const size_t inlineCapacity = std::string().capacity();
+    return text.capacity() > inlineCapacity ? text.capacity() + 1 : 0;
+}
+
+// Row id carried by a row-change notification; std::nullopt for an empty
+// payload (whole table changed, or notifications may have been missed)
+inline std::optional<int> parseNotificationId(const std::string& payload) {
+    int id = 0;
+    auto [end, ec] = std::from_chars(payload.data(), payload.data() + payload.size(), id);
+    if (payload.empty() || ec != std::errc() || end != payload.data() + payload.size()) {
+        return std::nullopt;
+    }
+    return id;
+}
+
+// Row ids carried by an insert notification ("12,13,40"); std::nullopt for
+// an empty payload (too many rows to list: reload the table)
+inline std::optional<std::vector<int>> parseNotificationIds(const std::string& payload) {
+    std::vector<int> ids;
+    const char* next = payload.data();
+    const char* end = payload.data() + payload.size();
+    while (next < end) {
+        int id = 0;
+        auto [stop, ec] = std::from_chars(next, end, id);
+        if (ec != std::errc() || (stop != end && *stop != ',')) {
+            return std::nullopt;
+        }
+        ids.push_back(id);
+        next = stop + 1;
+    }
+    if (ids.empty()) {
+        return std::nullopt;
+    }
+    return ids;
+}
+
+// Read-through cache of entities by id, for rows that are read far more
+// often than they change. Entries are dropped by invalidate() when the row
+// changes (locally or via a NOTIFY from another instance) and otherwise
+// only make room for more frequently used rows once the budget is reached.
+template<typename T>
+class EntityCache {
+public:
+    using HeapBytes = typename TinyLfuCache<int, T>::HeapBytes;
+
+    explicit EntityCache(size_t maxBytes = DEFAULT_ENTITY_CACHE_BYTES, HeapBytes heapBytes = {})
+        : cache(maxBytes, std::move(heapBytes)) {}
+
+    std::optional<T> getOrLoad(int id, const std::function<std::optional<T>()>& load) {
+        return cache.getOrLoad(id, load);
+    }
+
+    // Seed an entry with a row just read from the database, e.g. at startup
+    void prime(int id, const T& value) {
+        cache.put(id, value);
+    }
+
+    void invalidate(int id) {
+        cache.erase(id);
+    }
+
+    // Apply a row-change notification whose payload is the row id; an empty
+    // or unreadable payload clears the whole cache
+    void applyNotification(const std::string& payload) {
+        if (auto id = parseNotificationId(payload)) {
+            cache.erase(*id);
+        } else {
+            cache.clear();
+        }
+    }
+
+    void clear() {
+        cache.clear();
+    }
+
+    CacheStats getStats() const {
+        return cache.getStats();
+    }
+
+private:
+    TinyLfuCache<int, T> cache;
+};
+
+} // namespace HotelManagement
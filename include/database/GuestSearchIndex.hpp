@@ -0,0 +1,119 @@
+#pragma once
+
+#include "database/models/Guest.hpp"
+#include "utils/CompletionIndex.hpp"
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace HotelManagement {
+
+// One ranked search hit
+struct GuestMatch {
+    int guestId = 0;
+    int score = 0; // higher is better
+};
+
+// In-memory trigram inverted index over guest names, emails and phones.
+//
+// Every guest is stored as three normalized fields (lowercase "first last",
+// lowercase email, phone digits). Each three-byte window of a field, with
+// the field padded by two leading spaces, maps to a sorted posting list of
+// document slots. A query intersects the lists of its own trigrams and
+// checks the surviving candidates with a substring test, so results are
+// exact (case-insensitive for ASCII) rather than fuzzy. Emails are indexed
+// up to the '@' only: domains are shared by too many guests to narrow a
+// search and would dominate the index size.
+//
+// Updates append a new slot and retire the old one; retired slots are
+// dropped when enough of them accumulate. First and last names also feed a
+// CompletionIndex for autocomplete.
+class GuestSearchIndex {
+public:
+    using GuestVisitor = std::function<void(const Guest&)>;
+
+    GuestSearchIndex();
+    ~GuestSearchIndex() = default;
+
+    // Replace the contents with every guest scan() passes to its visitor.
+    // The new index is built without blocking searches.
+    void rebuild(const std::function<void(const GuestVisitor&)>& scan);
+
+    bool isLoaded() const;
+
+    // Keep in sync with repository writes
+    void upsert(const Guest& guest);
+    void remove(int guestId);
+
+    // Best matches first. Queries of three or more characters match anywhere
+    // in a field; two-character queries match the start of a word. Returns
+    // std::nullopt when the index is not loaded or the query is too short.
+    std::optional<std::vector<GuestMatch>> search(std::string_view query, size_t limit) const;
+
+    // First and last names starting with prefix, most common first.
+    // Returns std::nullopt when the index is not loaded.
+    std::optional<std::vector<Completion>> completeName(std::string_view prefix, size_t limit) const;
+
+    size_t size() const;
+
+    GuestSearchIndex(const GuestSearchIndex&) = delete;
+    GuestSearchIndex& operator=(const GuestSearchIndex&) = delete;
+
+private:
+    struct Document {
+        int guestId = 0;
+        uint32_t offset = 0; // into Contents::text
+        uint16_t nameLength = 0;
+        uint16_t emailLength = 0;
+        uint16_t phoneLength = 0;
+        bool alive = false;
+    };
+
+    struct Contents {
+        std::vector<Document> documents;
+        std::string text; // normalized fields of every document, back to back
+        std::vector<std::vector<uint32_t>> postings; // by trigram code
+        std::vector<uint32_t> slotByGuest; // by guest id (dense SERIAL values)
+        CompletionIndex names{2};          // first and last name by guest id
+        size_t live = 0;
+        size_t retired = 0;
+        bool loaded = false;
+    };
+
+    // Writes made during a rebuild, replayed onto the freshly built contents
+    struct PendingWrite {
+        int guestId = 0;
+        std::optional<Guest> guest; // std::nullopt = removed
+    };
+
+    mutable std::shared_mutex indexMutex;
+    Contents contents;
+
+    std::mutex pendingMutex; // taken after indexMutex
+    int rebuildsInProgress = 0;
+    std::vector<PendingWrite> pendingWrites;
+
+    static void addDocument(Contents& target, int guestId, std::string_view name,
+                            std::string_view email, std::string_view phone);
+    static void addGuest(Contents& target, const Guest& guest);
+    static void finishBuild(Contents& target);
+    static uint32_t slotOf(const Contents& target, int guestId);
+    void upsertLocked(const Guest& guest);
+    void removeLocked(int guestId);
+    void retire(uint32_t slot);
+    void compactIfNeeded();
+
+    // Slots whose documents hold every trigram code
+    std::vector<uint32_t> candidates(std::vector<uint32_t> codes) const;
+    // 0 when the document does not match; phone is the digits to look for
+    // in the phone field (empty to skip it)
+    int score(const Document& document, std::string_view query, std::string_view phone,
+              bool wordStartOnly) const;
+};
+
+} // namespace HotelManagement
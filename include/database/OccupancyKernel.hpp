@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace HotelManagement {
+
+// Bitset kernel behind AvailabilityIndex searches.
+// Uses AVX2 or SSE2 on x86-64 (selected once at runtime) and plain 64-bit
+// words everywhere else.
+class OccupancyKernel {
+public:
+    // Word count that keeps every bitset row a whole number of vector lanes
+    static constexpr size_t WORD_ALIGNMENT = 4;
+
+    // candidates &= ~rows[d] for each of rowCount rows laid out stride words apart.
+    // Each row holds `words` words.
+    static void clearOccupied(uint64_t* candidates, const uint64_t* rows,
+                              size_t words, size_t stride, size_t rowCount);
+
+    // Implementation selected for this CPU ("avx2", "sse2" or "scalar")
+    static const char* getName();
+};
+
+} // namespace HotelManagement
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <vector>
+#include <optional>
+
+namespace HotelManagement {
+
+// One page of a keyset-paginated listing. Pass nextKey back to findPage to
+// continue after the last item; it is empty on the final page.
+template<typename T, typename Key>
+struct Page {
+    std::vector<T> items;
+    std::optional<Key> nextKey;
+
+    bool hasMore() const {
+        return nextKey.has_value();
+    }
+};
+
+} // namespace HotelManagement
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "utils/CivilDate.hpp"
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <pqxx/pqxx>
+
+namespace HotelManagement {
+
+// Column list of a table, declared once. Queries select the columns in this
+// order, so row mappers read fields by position instead of by name:
+//
+//   constexpr TableSchema BOOKINGS("bookings", std::to_array<std::string_view>({"id", "guest_id", "room_id"}));
+//   constexpr int COL_GUEST_ID = BOOKINGS.column("guest_id"); // unknown names fail to compile
+//   row[COL_GUEST_ID]
+template<size_t N>
+class TableSchema {
+public:
+    constexpr TableSchema(std::string_view tableName, const std::array<std::string_view, N>& columnNames)
+        : table(tableName), columns(columnNames) {}
+
+    // Position of a column in the select list
+    constexpr int column(std::string_view name) const {
+        for (size_t i = 0; i < N; i++) {
+            if (columns[i] == name) {
+                return static_cast<int>(i);
+            }
+        }
+        throw std::logic_error("TableSchema: unknown column");
+    }
+
+    static constexpr size_t size() { return N; }
+
+    constexpr std::string_view getTable() const { return table; }
+
+    // "id, guest_id, ..." with an optional table alias prefix
+    std::string columnList(std::string_view alias = {}) const {
+        std::string list;
+        for (size_t i = 0; i < N; i++) {
+            if (i > 0) {
+                list += ", ";
+            }
+            if (!alias.empty()) {
+                list.append(alias).append(".");
+            }
+            list.append(columns[i]);
+        }
+        return list;
+    }
+
+    // "SELECT <columns> FROM <table> " ready for a WHERE/ORDER BY suffix
+    std::string selectSql() const {
+        std::string sql = "SELECT " + columnList() + " FROM ";
+        sql.append(table).append(" ");
+        return sql;
+    }
+
+private:
+    std::string_view table;
+    std::array<std::string_view, N> columns;
+};
+
+// Field decoding without the name lookups and temporary strings of
+// field.as<std::string>(); text is read straight from the result buffer
+class FieldReader {
+public:
+    static std::string_view view(const pqxx::field& field) {
+        return std::string_view(field.c_str(), field.size());
+    }
+
+    static std::string text(const pqxx::field& field, std::string_view ifNull = {}) {
+        return field.is_null() ? std::string(ifNull) : std::string(field.c_str(), field.size());
+    }
+
+    static int integer(const pqxx::field& field, int ifNull = 0) {
+        return field.is_null() ? ifNull : field.as<int>();
+    }
+
+    static double number(const pqxx::field& field, double ifNull = 0.0) {
+        return field.is_null() ? ifNull : field.as<double>();
+    }
+
+    // PostgreSQL sends booleans as 't' / 'f'
+    static bool boolean(const pqxx::field& field) {
+        return !field.is_null() && field.size() > 0 && field.c_str()[0] == 't';
+    }
+
+    // Date columns arrive as YYYY-MM-DD text
+    static CivilDate date(const pqxx::field& field) {
+        return field.is_null() ? CivilDate() : CivilDate::parse(view(field));
+    }
+};
+
+// Array literal for an int[] parameter, as in "WHERE id = ANY($1::int[])"
+inline std::string intArrayLiteral(const std::vector<int>& values) {
+    std::string literal = "{";
+    for (size_t i = 0; i < values.size(); i++) {
+        if (i > 0) literal += ',';
+        literal += std::to_string(values[i]);
+    }
+    literal += '}';
+    return literal;
+}
+
+} // namespace HotelManagement
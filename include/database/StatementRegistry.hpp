@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <pqxx/pqxx>
+
+namespace HotelManagement {
+
+// Named SQL statement, prepared once per connection
+struct PreparedStatement {
+    std::string name;
+    std::string sql;
+};
+
+// Append-only set of statements shared by all pooled connections.
+// Repositories declare their statements once; each connection prepares the
+// ones it has not seen yet when it is leased.
+class StatementRegistry {
+public:
+    StatementRegistry() = default;
+
+    // Register statements. Re-registering a name with identical SQL is a no-op;
+    // registering it with different SQL throws std::invalid_argument.
+    void add(const std::vector<PreparedStatement>& newStatements);
+
+    // Prepare every statement registered after the first `preparedCount` ones,
+    // advancing preparedCount as each one succeeds
+    void prepareOn(pqxx::connection& conn, size_t& preparedCount) const;
+
+    size_t size() const;
+
+    StatementRegistry(const StatementRegistry&) = delete;
+    StatementRegistry& operator=(const StatementRegistry&) = delete;
+
+private:
+    mutable std::mutex registryMutex;
+    std::vector<PreparedStatement> statements;
+    std::unordered_map<std::string, size_t> byName;
+};
+
+} // namespace HotelManagement
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "utils/CivilDate.hpp"
+#include "utils/EnumDecoder.hpp"
 #include <string>
+#include <string_view>
 #include <optional>
 
 namespace HotelManagement {
@@ -17,8 +20,8 @@ struct Booking {
     int id = 0;
     int guestId = 0;
     int roomId = 0;
-    std::string checkInDate;  // YYYY-MM-DD
-    std::string checkOutDate; // YYYY-MM-DD
+    CivilDate checkInDate;
+    CivilDate checkOutDate;
     std::string actualCheckIn;  // YYYY-MM-DD HH:MM:SS (optional)
     std::string actualCheckOut; // YYYY-MM-DD HH:MM:SS (optional)
     int numAdults = 1;
@@ -32,10 +35,12 @@ struct Booking {
     // Default constructor
     Booking() = default;
 
+    bool operator==(const Booking&) const = default;
+
     // Helper methods
     bool isValid() const {
         return guestId > 0 && roomId > 0 &&
-               !checkInDate.empty() && !checkOutDate.empty() &&
+               checkInDate.isValid() && checkOutDate.isValid() &&
                numAdults > 0;
     }
 
@@ -52,9 +57,14 @@ struct Booking {
         return status == BookingStatus::CheckedIn;
     }
 
-    int getDurationDays() const;
+    int getDurationDays() const {
+        return checkOutDate - checkInDate;
+    }
 
-    bool overlaps(const std::string& start, const std::string& end) const;
+    // Stays are half-open [checkIn, checkOut): (start1 < end2) AND (start2 < end1)
+    bool overlaps(CivilDate start, CivilDate end) const {
+        return checkInDate < end && start < checkOutDate;
+    }
 
     // Convert status enum to string
     std::string statusToString() const {
@@ -69,13 +79,15 @@ struct Booking {
     }
 
     // Convert string to status enum
-    static BookingStatus stringToStatus(const std::string& statusStr) {
-        if (statusStr == "pending") return BookingStatus::Pending;
-        if (statusStr == "confirmed") return BookingStatus::Confirmed;
-        if (statusStr == "checked_in") return BookingStatus::CheckedIn;
-        if (statusStr == "checked_out") return BookingStatus::CheckedOut;
-        if (statusStr == "cancelled") return BookingStatus::Cancelled;
-        return BookingStatus::Pending; // default
+    static BookingStatus stringToStatus(std::string_view statusStr) {
+        static constexpr EnumDecoder<BookingStatus, 5> decoder({{
+            {"pending", BookingStatus::Pending},
+            {"confirmed", BookingStatus::Confirmed},
+            {"checked_in", BookingStatus::CheckedIn},
+            {"checked_out", BookingStatus::CheckedOut},
+            {"cancelled", BookingStatus::Cancelled},
+        }});
+        return decoder.decode(statusStr, BookingStatus::Pending); // default
     }
 
     std::string toString() const {
@@ -0,0 +1,29 @@
+#pragma once
+
+namespace HotelManagement {
+
+// Aggregate counters shown on the dashboard, fetched in one round trip
+struct DashboardStats {
+    int totalRooms = 0;
+    int availableRooms = 0;
+    int occupiedRooms = 0;
+    int maintenanceRooms = 0;
+    int reservedRooms = 0;
+    int totalGuests = 0;
+    int vipGuests = 0;
+    int activeBookings = 0;
+    int todayCheckIns = 0;
+    int todayCheckOuts = 0;
+
+    // Default constructor
+    DashboardStats() = default;
+
+    bool operator==(const DashboardStats&) const = default;
+
+    // Helper methods
+    double getOccupancyRate() const {
+        return totalRooms > 0 ? static_cast<double>(occupiedRooms) / totalRooms : 0.0;
+    }
+};
+
+} // namespace HotelManagement
@@ -23,6 +23,8 @@ struct Guest {
     // Default constructor
     Guest() = default;
 
+    bool operator==(const Guest&) const = default;
+
     // Helper methods
     bool isValid() const {
         return !firstName.empty() && !lastName.empty() &&
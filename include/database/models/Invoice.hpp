@@ -1,6 +1,9 @@
 #pragma once
 
+#include "utils/CivilDate.hpp"
+#include "utils/EnumDecoder.hpp"
 #include <string>
+#include <string_view>
 
 namespace HotelManagement {
 
@@ -16,7 +19,7 @@ struct Invoice {
     int bookingId = 0;
     std::string invoiceNumber;
     std::string issueDate; // YYYY-MM-DD HH:MM:SS
-    std::string dueDate;   // YYYY-MM-DD
+    CivilDate dueDate;
     double subtotal = 0.0;
     double taxAmount = 0.0;
     double discountAmount = 0.0;
@@ -55,12 +58,14 @@ struct Invoice {
     }
 
     // Convert string to status enum
-    static InvoiceStatus stringToStatus(const std::string& statusStr) {
-        if (statusStr == "unpaid") return InvoiceStatus::Unpaid;
-        if (statusStr == "partially_paid") return InvoiceStatus::PartiallyPaid;
-        if (statusStr == "paid") return InvoiceStatus::Paid;
-        if (statusStr == "cancelled") return InvoiceStatus::Cancelled;
-        return InvoiceStatus::Unpaid; // default
+    static InvoiceStatus stringToStatus(std::string_view statusStr) {
+        static constexpr EnumDecoder<InvoiceStatus, 4> decoder({{
+            {"unpaid", InvoiceStatus::Unpaid},
+            {"partially_paid", InvoiceStatus::PartiallyPaid},
+            {"paid", InvoiceStatus::Paid},
+            {"cancelled", InvoiceStatus::Cancelled},
+        }});
+        return decoder.decode(statusStr, InvoiceStatus::Unpaid); // default
     }
 
     std::string toString() const {
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "utils/EnumDecoder.hpp"
 #include <string>
+#include <string_view>
 
 namespace HotelManagement {
 
@@ -55,13 +57,15 @@ struct Payment {
     }
 
     // Convert string to payment method enum
-    static PaymentMethod stringToPaymentMethod(const std::string& methodStr) {
-        if (methodStr == "cash") return PaymentMethod::Cash;
-        if (methodStr == "credit_card") return PaymentMethod::CreditCard;
-        if (methodStr == "debit_card") return PaymentMethod::DebitCard;
-        if (methodStr == "bank_transfer") return PaymentMethod::BankTransfer;
-        if (methodStr == "mobile_payment") return PaymentMethod::MobilePayment;
-        return PaymentMethod::Cash; // default
+    static PaymentMethod stringToPaymentMethod(std::string_view methodStr) {
+        static constexpr EnumDecoder<PaymentMethod, 5> decoder({{
+            {"cash", PaymentMethod::Cash},
+            {"credit_card", PaymentMethod::CreditCard},
+            {"debit_card", PaymentMethod::DebitCard},
+            {"bank_transfer", PaymentMethod::BankTransfer},
+            {"mobile_payment", PaymentMethod::MobilePayment},
+        }});
+        return decoder.decode(methodStr, PaymentMethod::Cash); // default
     }
 
     // Convert status enum to string
@@ -76,12 +80,14 @@ struct Payment {
     }
 
     // Convert string to status enum
-    static PaymentStatus stringToStatus(const std::string& statusStr) {
-        if (statusStr == "pending") return PaymentStatus::Pending;
-        if (statusStr == "completed") return PaymentStatus::Completed;
-        if (statusStr == "failed") return PaymentStatus::Failed;
-        if (statusStr == "refunded") return PaymentStatus::Refunded;
-        return PaymentStatus::Pending; // default
+    static PaymentStatus stringToStatus(std::string_view statusStr) {
+        static constexpr EnumDecoder<PaymentStatus, 4> decoder({{
+            {"pending", PaymentStatus::Pending},
+            {"completed", PaymentStatus::Completed},
+            {"failed", PaymentStatus::Failed},
+            {"refunded", PaymentStatus::Refunded},
+        }});
+        return decoder.decode(statusStr, PaymentStatus::Pending); // default
     }
 
     std::string toString() const {
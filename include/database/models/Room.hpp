@@ -1,6 +1,8 @@
 #pragma once
 
+#include "utils/EnumDecoder.hpp"
 #include <string>
+#include <string_view>
 
 namespace HotelManagement {
 
@@ -24,6 +26,8 @@ struct Room {
     // Default constructor
     Room() = default;
 
+    bool operator==(const Room&) const = default;
+
     // Helper methods
     bool isValid() const {
         return !roomNumber.empty() && roomTypeId > 0 && floorNumber > 0;
@@ -49,12 +53,14 @@ struct Room {
     }
 
     // Convert string to status enum
-    static RoomStatus stringToStatus(const std::string& statusStr) {
-        if (statusStr == "available") return RoomStatus::Available;
-        if (statusStr == "occupied") return RoomStatus::Occupied;
-        if (statusStr == "maintenance") return RoomStatus::Maintenance;
-        if (statusStr == "reserved") return RoomStatus::Reserved;
-        return RoomStatus::Available; // default
+    static RoomStatus stringToStatus(std::string_view statusStr) {
+        static constexpr EnumDecoder<RoomStatus, 4> decoder({{
+            {"available", RoomStatus::Available},
+            {"occupied", RoomStatus::Occupied},
+            {"maintenance", RoomStatus::Maintenance},
+            {"reserved", RoomStatus::Reserved},
+        }});
+        return decoder.decode(statusStr, RoomStatus::Available); // default
     }
 
     std::string toString() const {
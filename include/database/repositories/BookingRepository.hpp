@@ -1,24 +1,58 @@
 #pragma once
 
 #include "database/DatabaseManager.hpp"
+#include "database/AvailabilityIndex.hpp"
+#include "database/EntityCache.hpp"
+#include "database/Page.hpp"
 #include "database/models/Booking.hpp"
 #include <vector>
 #include <optional>
+#include <functional>
 
 namespace HotelManagement {
 
+// Position in the booking listing order (check_in_date DESC, id DESC)
+struct BookingKey {
+    CivilDate checkInDate;
+    int id = 0;
+};
+
+using BookingPage = Page<Booking, BookingKey>;
+
 class BookingRepository {
 public:
-    explicit BookingRepository(DatabaseManager& dbManager);
-    ~BookingRepository() = default;
+    explicit BookingRepository(DatabaseManager& dbManager, size_t cacheBytes = DEFAULT_ENTITY_CACHE_BYTES);
+    ~BookingRepository();
 
+    // Served from a cache kept coherent by NOTIFY triggers once the
+    // DatabaseManager listener runs
     std::optional<Booking> findById(int id);
     std::vector<Booking> findAll();
+    // Same, but throws on failure instead of returning an empty list
+    std::vector<Booking> loadAll();
+
+    // Keyset pagination in findAll order (newest first); pass std::nullopt for the first page
+    BookingPage findPage(const std::optional<BookingKey>& after, size_t limit);
+
+    // Visit every booking in findAll order without loading them all at once.
+    // The visitor returns false to stop. Returns the number of bookings visited.
+    size_t forEach(const std::function<bool(const Booking&)>& visitor, size_t batchSize = 1000);
     std::vector<Booking> findByGuestId(int guestId);
     std::vector<Booking> findByRoomId(int roomId);
     std::vector<Booking> findByStatus(BookingStatus status);
+    // Bookings still holding a room on or after the given date
+    std::vector<Booking> findActiveFrom(CivilDate date);
+    // Same, but throws on failure instead of returning an empty list
+    std::vector<Booking> loadActiveFrom(CivilDate date);
 
     int create(const Booking& booking);
+
+    // Bulk insert over COPY in a single transaction. Returns the new ids in
+    // input order, or an empty vector if nothing was inserted.
+    std::vector<int> createMany(const std::vector<Booking>& bookings);
+
+    // Stream every booking over COPY (fastest full-table read)
+    size_t exportAll(const std::function<void(const Booking&)>& visitor);
     bool update(const Booking& booking);
     bool deleteById(int id);
 
@@ -29,9 +63,30 @@ public:
     int getTodayCheckIns();
     int getTodayCheckOuts();
 
+    // Attach an in-memory availability index kept in sync with booking writes
+    // here and, through NOTIFY, elsewhere. Set before the listener starts.
+    void setAvailabilityIndex(AvailabilityIndex* index);
+
+    // Seed the cache with bookings already loaded (startup warm-up)
+    void primeCache(const std::vector<Booking>& bookings);
+
+    // Cache counters (hits, evictions, memory use, ...)
+    CacheStats getCacheStats() const;
+
+    // Decode a row whose columns follow the bookings select list (id,
+    // guest_id, room_id, ... updated_at, as in setup_db.sql). Public for
+    // row_mapper_bench.
+    static Booking rowToBooking(const pqxx::row& row);
+
 private:
     DatabaseManager& dbManager;
-    Booking rowToBooking(const pqxx::row& row);
+    AvailabilityIndex* availabilityIndex = nullptr;
+
+    EntityCache<Booking> bookingCache;
+    int handlerId = 0;
+    int insertHandlerId = 0;
+
+    void refreshAvailability(const std::string& payload);
 };
 
 } // namespace HotelManagement
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "database/DatabaseManager.hpp"
+#include "database/models/DashboardStats.hpp"
+
+namespace HotelManagement {
+
+class DashboardRepository {
+public:
+    explicit DashboardRepository(DatabaseManager& dbManager);
+    ~DashboardRepository() = default;
+
+    // All dashboard counters in a single pipelined round trip
+    DashboardStats fetchStats();
+
+private:
+    DatabaseManager& dbManager;
+};
+
+} // namespace HotelManagement
@@ -1,25 +1,59 @@
 #pragma once
 
 #include "database/DatabaseManager.hpp"
+#include "database/EntityCache.hpp"
+#include "database/GuestSearchIndex.hpp"
+#include "database/Page.hpp"
 #include "database/models/Guest.hpp"
 #include <vector>
 #include <optional>
+#include <functional>
+#include <atomic>
 
 namespace HotelManagement {
 
+// Position in the guest listing order (last_name, first_name, id)
+struct GuestKey {
+    std::string lastName;
+    std::string firstName;
+    int id = 0;
+};
+
+using GuestPage = Page<Guest, GuestKey>;
+
 class GuestRepository {
 public:
-    explicit GuestRepository(DatabaseManager& dbManager);
-    ~GuestRepository() = default;
+    explicit GuestRepository(DatabaseManager& dbManager, size_t cacheBytes = DEFAULT_ENTITY_CACHE_BYTES);
+    ~GuestRepository();
 
-    // CRUD operations
+    // CRUD operations (findById is served from a cache kept coherent by
+    // NOTIFY triggers once the DatabaseManager listener runs)
     std::optional<Guest> findById(int id);
     std::vector<Guest> findAll();
-    std::vector<Guest> searchByName(const std::string& name);
+    // Same, but throws on failure instead of returning an empty list
+    std::vector<Guest> loadAll();
+
+    // Keyset pagination in findAll order; pass std::nullopt for the first page
+    GuestPage findPage(const std::optional<GuestKey>& after, size_t limit);
+
+    // Visit every guest in findAll order without loading them all at once.
+    // The visitor returns false to stop. Returns the number of guests visited.
+    size_t forEach(const std::function<bool(const Guest&)>& visitor, size_t batchSize = 1000);
+    // Guests whose name, email or phone contains the text, best matches first.
+    // Answered from the search index when one is attached and can take the
+    // query, otherwise by a name-only ILIKE query in name order.
+    std::vector<Guest> searchByName(const std::string& name, size_t limit = 100);
     std::optional<Guest> findByEmail(const std::string& email);
     std::optional<Guest> findByPhone(const std::string& phone);
 
     int create(const Guest& guest);
+
+    // Bulk insert over COPY in a single transaction. Returns the new ids in
+    // input order, or an empty vector if nothing was inserted.
+    std::vector<int> createMany(const std::vector<Guest>& guests);
+
+    // Stream every guest over COPY (fastest full-table read)
+    size_t exportAll(const std::function<void(const Guest&)>& visitor);
     bool update(const Guest& guest);
     bool deleteById(int id);
 
@@ -27,9 +61,29 @@ public:
     int getTotalGuests();
     int getVIPCount();
 
+    // Cache counters (hits, evictions, memory use, ...)
+    CacheStats getCacheStats() const;
+
+    // Attach an in-memory search index kept in sync with guest writes and
+    // row-change notifications, then load it with rebuildSearchIndex()
+    void setSearchIndex(GuestSearchIndex* index);
+    bool rebuildSearchIndex();
+
 private:
     DatabaseManager& dbManager;
+    std::atomic<GuestSearchIndex*> searchIndex{nullptr};
+
+    EntityCache<Guest> guestCache;
+    int handlerId = 0;
+    int insertHandlerId = 0;
     Guest rowToGuest(const pqxx::row& row);
+
+    // Full table over COPY in id order; throws on failure
+    size_t streamAll(const std::function<void(const Guest&)>& visitor);
+    std::vector<Guest> findByIds(const std::vector<int>& ids);
+    std::vector<Guest> loadByIds(const std::vector<int>& ids);
+    void refreshSearchEntry(const std::string& payload);
+    void indexInsertedGuests(const std::string& payload);
 };
 
 } // namespace HotelManagement
@@ -1,51 +1,113 @@
 #pragma once
 
 #include "database/DatabaseManager.hpp"
+#include "database/AvailabilityIndex.hpp"
+#include "database/EntityCache.hpp"
+#include "database/Page.hpp"
 #include "database/models/Room.hpp"
 #include "database/models/RoomType.hpp"
 #include <vector>
 #include <optional>
+#include <map>
+#include <functional>
 
 namespace HotelManagement {
 
+// Position in the room listing order (floor_number, room_number)
+struct RoomKey {
+    int floorNumber = 0;
+    std::string roomNumber;
+};
+
+using RoomPage = Page<Room, RoomKey>;
+
 class RoomRepository {
 public:
-    explicit RoomRepository(DatabaseManager& dbManager);
-    ~RoomRepository() = default;
+    explicit RoomRepository(DatabaseManager& dbManager,
+                            size_t roomCacheBytes = DEFAULT_ENTITY_CACHE_BYTES,
+                            size_t roomTypeCacheBytes = DEFAULT_ENTITY_CACHE_BYTES);
+    ~RoomRepository();
 
-    // CRUD operations
+    // CRUD operations (findById is served from a cache kept coherent by
+    // NOTIFY triggers once the DatabaseManager listener runs)
     std::optional<Room> findById(int id);
     std::vector<Room> findAll();
+    // Same, but throws on failure instead of returning an empty list
+    std::vector<Room> loadAll();
+
+    // Keyset pagination in findAll order; pass std::nullopt for the first page
+    RoomPage findPage(const std::optional<RoomKey>& after, size_t limit);
+
+    // Visit every room in findAll order without loading them all at once.
+    // The visitor returns false to stop. Returns the number of rooms visited.
+    size_t forEach(const std::function<bool(const Room&)>& visitor, size_t batchSize = 1000);
     std::vector<Room> findByFloor(int floorNumber);
     std::vector<Room> findByStatus(RoomStatus status);
     std::vector<Room> findByRoomType(int roomTypeId);
 
     int create(const Room& room);
+
+    // Bulk insert over COPY in a single transaction. Returns the new ids in
+    // input order, or an empty vector if nothing was inserted.
+    std::vector<int> createMany(const std::vector<Room>& rooms);
+
+    // Stream every room over COPY (fastest full-table read)
+    size_t exportAll(const std::function<void(const Room&)>& visitor);
     bool update(const Room& room);
     bool deleteById(int id);
 
-    // Business logic
+    // Business logic (answered from the availability index when one is attached)
     bool isRoomAvailable(int roomId, const std::string& startDate, const std::string& endDate);
     std::vector<int> getAvailableRoomIds(const std::string& startDate, const std::string& endDate);
     bool updateRoomStatus(int roomId, RoomStatus newStatus);
 
+    // Batched search over many candidate stays; results line up with the queries
+    std::vector<std::vector<int>> findAvailableRooms(const std::vector<AvailabilityQuery>& queries);
+
+    // SQL availability queries, used as fallback and for verifying the index
+    bool isRoomAvailableInDatabase(int roomId, const std::string& startDate, const std::string& endDate);
+    std::vector<int> getAvailableRoomIdsInDatabase(const std::string& startDate, const std::string& endDate);
+    std::vector<std::vector<int>> findAvailableRoomsInDatabase(const std::vector<AvailabilityQuery>& queries);
+
+    // Attach an in-memory availability index kept in sync with room writes
+    // here and, through NOTIFY, elsewhere. Set before the listener starts.
+    void setAvailabilityIndex(AvailabilityIndex* index);
+
     // Statistics
     int getTotalRooms();
     int getRoomsByStatus(RoomStatus status);
     std::map<RoomStatus, int> getRoomCountByStatus();
 
-    // Room Type operations
+    // Room Type operations (findRoomTypeById is cached like findById)
     std::optional<RoomType> findRoomTypeById(int id);
     std::vector<RoomType> findAllRoomTypes();
+    std::vector<RoomType> loadAllRoomTypes(); // throws on failure
     int createRoomType(const RoomType& roomType);
     bool updateRoomType(const RoomType& roomType);
 
+    // Seed the caches with rows already loaded (startup warm-up)
+    void primeCaches(const std::vector<Room>& rooms, const std::vector<RoomType>& roomTypes);
+
+    // Cache counters (hits, evictions, memory use, ...)
+    CacheStats getRoomCacheStats() const;
+    CacheStats getRoomTypeCacheStats() const;
+
 private:
     DatabaseManager& dbManager;
+    AvailabilityIndex* availabilityIndex = nullptr;
+
+    EntityCache<Room> roomCache;
+    EntityCache<RoomType> roomTypeCache;
+    int roomHandlerId = 0;
+    int roomInsertHandlerId = 0;
+    int roomTypeHandlerId = 0;
+    int roomTypeInsertHandlerId = 0;
 
     // Helper to convert database row to Room object
     Room rowToRoom(const pqxx::row& row);
     RoomType rowToRoomType(const pqxx::row& row);
+
+    void refreshAvailability(const std::string& payload, bool roomTypes);
 };
 
 } // namespace HotelManagement
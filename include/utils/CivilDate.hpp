@@ -0,0 +1,157 @@
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace HotelManagement {
+
+// Calendar date stored as days since 1970-01-01 (proleptic Gregorian).
+// Trivially copyable and constexpr throughout, so comparisons and stay-length
+// math are plain integer operations. A default-constructed date is invalid
+// and sorts before every valid date.
+class CivilDate {
+public:
+    constexpr CivilDate() = default;
+
+    static constexpr CivilDate fromDays(int32_t days) {
+        return CivilDate(days);
+    }
+
+    // Invalid date if the fields do not name a real day in years 0000-9999
+    static constexpr CivilDate fromYmd(int year, int month, int day) {
+        if (year < 0 || year > 9999 || month < 1 || month > 12 ||
+            day < 1 || day > daysInMonth(year, month)) {
+            return CivilDate();
+        }
+        return CivilDate(daysFromCivil(year, month, day));
+    }
+
+    // Parse YYYY-MM-DD (PostgreSQL date output); invalid date on any error
+    static constexpr CivilDate parse(std::string_view text) {
+        if (text.size() != 10 || text[4] != '-' || text[7] != '-') {
+            return CivilDate();
+        }
+        for (size_t i = 0; i < text.size(); i++) {
+            if (i != 4 && i != 7 && (text[i] < '0' || text[i] > '9')) {
+                return CivilDate();
+            }
+        }
+        return fromYmd(digits(text, 0, 4), digits(text, 5, 2), digits(text, 8, 2));
+    }
+
+    constexpr bool isValid() const { return days != INVALID; }
+    constexpr int32_t daysSinceEpoch() const { return days; }
+
+    constexpr int year() const { return toCivil().year; }
+    constexpr int month() const { return toCivil().month; }
+    constexpr int day() const { return toCivil().day; }
+
+    // 0 = Sunday ... 6 = Saturday
+    constexpr int dayOfWeek() const {
+        return days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6;
+    }
+
+    constexpr CivilDate addDays(int count) const {
+        return isValid() ? CivilDate(days + count) : CivilDate();
+    }
+
+    // Whole days from `other` to this date
+    constexpr int operator-(const CivilDate& other) const { return days - other.days; }
+    constexpr CivilDate operator+(int count) const { return addDays(count); }
+    constexpr CivilDate operator-(int count) const { return addDays(-count); }
+
+    constexpr bool operator==(const CivilDate&) const = default;
+    constexpr auto operator<=>(const CivilDate&) const = default;
+
+    // YYYY-MM-DD plus terminator, without allocating; empty for invalid dates
+    constexpr std::array<char, 11> toChars() const {
+        std::array<char, 11> out{};
+        if (!isValid()) {
+            return out;
+        }
+        Fields f = toCivil();
+        writeDigits(out.data(), f.year, 4);
+        out[4] = '-';
+        writeDigits(out.data() + 5, f.month, 2);
+        out[7] = '-';
+        writeDigits(out.data() + 8, f.day, 2);
+        return out;
+    }
+
+    std::string toString() const {
+        return isValid() ? std::string(toChars().data(), 10) : std::string();
+    }
+
+    static constexpr bool isLeapYear(int year) {
+        return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+    }
+
+    static constexpr int daysInMonth(int year, int month) {
+        constexpr int lengths[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        if (month < 1 || month > 12) {
+            return 0;
+        }
+        return lengths[month - 1] + (month == 2 && isLeapYear(year) ? 1 : 0);
+    }
+
+private:
+    static constexpr int32_t INVALID = std::numeric_limits<int32_t>::min();
+
+    struct Fields {
+        int year;
+        int month;
+        int day;
+    };
+
+    int32_t days = INVALID;
+
+    constexpr explicit CivilDate(int32_t d) : days(d) {}
+
+    // Howard Hinnant's days_from_civil / civil_from_days
+    static constexpr int32_t daysFromCivil(int y, int m, int d) {
+        y -= m <= 2;
+        int era = (y >= 0 ? y : y - 399) / 400;
+        int yoe = y - era * 400;
+        int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+    constexpr Fields toCivil() const {
+        int z = days + 719468;
+        int era = (z >= 0 ? z : z - 146096) / 146097;
+        int doe = z - era * 146097;
+        int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        int mp = (5 * doy + 2) / 153;
+        int d = doy - (153 * mp + 2) / 5 + 1;
+        int m = mp < 10 ? mp + 3 : mp - 9;
+        return Fields{yoe + era * 400 + (m <= 2), m, d};
+    }
+
+    static constexpr int digits(std::string_view text, size_t pos, size_t count) {
+        int value = 0;
+        for (size_t i = pos; i < pos + count; i++) {
+            value = value * 10 + (text[i] - '0');
+        }
+        return value;
+    }
+
+    static constexpr void writeDigits(char* out, int value, int count) {
+        for (int i = count - 1; i >= 0; i--) {
+            out[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+    }
+};
+
+static_assert(CivilDate::parse("1970-01-01").daysSinceEpoch() == 0);
+static_assert(CivilDate::parse("2024-02-29") - CivilDate::parse("2024-02-01") == 28);
+static_assert(!CivilDate::parse("2023-02-29").isValid());
+static_assert(CivilDate::parse("2026-01-15").dayOfWeek() == 4);
+
+} // namespace HotelManagement
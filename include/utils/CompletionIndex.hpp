@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace HotelManagement {
+
+// One autocomplete suggestion
+struct Completion {
+    std::string text;
+    uint32_t weight = 0; // owners carrying the term
+};
+
+// Prefix completion over short terms (names, room numbers) contributed by
+// owners (row ids). A term's weight is the number of owners carrying it;
+// complete() returns the heaviest terms starting with a prefix,
+// case-insensitively for ASCII.
+//
+// Terms live in one sorted array of keys packed into a single string, so a
+// prefix is a contiguous range found by binary search. The largest weight of
+// each block of 64 terms lets top-k skip blocks that cannot beat the k-th
+// best. New terms go to a short sorted side list that is merged into the
+// array once it holds MAX_RECENT terms. Writes find terms through an
+// open-addressing hash table of term ids.
+//
+// Not synchronized: the owner serializes writes against reads.
+class CompletionIndex {
+public:
+    explicit CompletionIndex(size_t termsPerOwner = 1);
+
+    // Replace the terms of an owner (at most termsPerOwner; empty ones are
+    // skipped). Owner ids are expected to be dense positive values.
+    void assign(int ownerId, std::initializer_list<std::string_view> terms);
+    void remove(int ownerId);
+    void clear();
+
+    // Up to limit completions of prefix, heaviest first, ties in key order
+    std::vector<Completion> complete(std::string_view prefix, size_t limit) const;
+
+    // Distinct terms carried by at least one owner
+    size_t size() const { return liveTerms; }
+
+private:
+    struct Term {
+        uint32_t offset = 0; // into keys and displays
+        uint16_t length = 0;
+    };
+
+    size_t termsPerOwner;
+
+    std::string keys;     // ASCII-lowercased terms, back to back
+    std::string displays; // terms as first seen, same offsets as keys
+    std::vector<Term> terms;        // by term id
+    std::vector<uint32_t> weights;  // by term id
+    std::vector<uint32_t> positions; // in sorted by term id (NO_POSITION while recent)
+    std::vector<uint32_t> buckets;   // term ids by key hash, linear probing
+
+    std::vector<uint32_t> sorted;        // term ids in key order
+    std::vector<uint32_t> sortedWeights; // weights in sorted order
+    std::vector<uint32_t> blockMax;      // largest weight per block of sorted
+    std::vector<uint32_t> recent;        // newer term ids in key order
+    size_t liveTerms = 0;
+
+    std::vector<uint32_t> ownerTerms; // termsPerOwner entries per owner id
+
+    std::string_view keyOf(uint32_t termId) const;
+    size_t lowerBound(std::string_view key) const;
+    uint32_t findOrAdd(std::string_view display, std::string_view key);
+    void addWeight(uint32_t termId);
+    void dropWeight(uint32_t termId);
+    void merge();
+    void compactTerms();
+    void rehash(size_t bucketCount);
+};
+
+} // namespace HotelManagement
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <istream>
+#include <ostream>
+
+namespace HotelManagement {
+
+// RFC 4180 CSV: comma separated, fields optionally quoted with "" as an
+// escaped quote. Quoted fields may span lines.
+class CsvReader {
+public:
+    explicit CsvReader(std::istream& input);
+
+    // Read the next record into fields. Returns false at end of input.
+    bool next(std::vector<std::string>& fields);
+
+    // 1-based line number where the last record started
+    size_t getLineNumber() const { return recordLine; }
+
+private:
+    std::istream& input;
+    std::string line;
+    size_t currentLine = 0;
+    size_t recordLine = 0;
+};
+
+// Same format read from an in-memory buffer (e.g. a MappedFile view).
+// Unquoted fields are copied straight out of the buffer.
+class CsvBufferReader {
+public:
+    // firstLine is the file line number data starts on
+    explicit CsvBufferReader(std::string_view data, size_t firstLine = 1);
+
+    // Read the next record into fields. Returns false at end of data.
+    bool next(std::vector<std::string>& fields);
+
+    // 1-based line number where the last record started
+    size_t getLineNumber() const { return recordLine; }
+
+    // Offset of the next unread byte
+    size_t getOffset() const { return pos; }
+
+    // End offset of the first record ending at or after minEnd, scanning
+    // from start (which must begin a record). Adds the line breaks in
+    // [start, end) to lines.
+    static size_t findRecordEnd(std::string_view data, size_t start, size_t minEnd, size_t& lines);
+
+private:
+    std::string_view data;
+    size_t pos = 0;
+    size_t currentLine;
+    size_t recordLine = 0;
+};
+
+class CsvWriter {
+public:
+    explicit CsvWriter(std::ostream& output);
+
+    void writeRow(const std::vector<std::string>& fields);
+    void writeRow(std::initializer_list<std::string_view> fields);
+
+private:
+    std::ostream& output;
+    std::string buffer;
+
+    void appendField(std::string_view field);
+};
+
+// Header name -> column index lookup for a CSV file
+class CsvHeader {
+public:
+    explicit CsvHeader(const std::vector<std::string>& names);
+
+    // -1 if the column is missing
+    int indexOf(std::string_view name) const;
+
+    // Field value for a column, or "" if the column or field is missing
+    const std::string& get(const std::vector<std::string>& fields, std::string_view name) const;
+
+private:
+    std::vector<std::string> names;
+};
+
+} // namespace HotelManagement
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "utils/CivilDate.hpp"
 #include <string>
 #include <chrono>
 #include <optional>
@@ -11,6 +12,9 @@ public:
     // Get current date as string (YYYY-MM-DD)
     static std::string getCurrentDate();
 
+    // Get current local date
+    static CivilDate getToday();
+
     // Get current date and time as string (YYYY-MM-DD HH:MM:SS)
     static std::string getCurrentDateTime();
 
@@ -72,6 +76,9 @@ public:
     static std::string getCurrentTime();
 
 private:
+    // Parse YYYY-MM-DD within the supported years (1900-2100); invalid otherwise
+    static CivilDate toCivilDate(const std::string& dateStr);
+
     // Helper to convert std::tm to time_point
     static std::chrono::system_clock::time_point tmToTimePoint(const std::tm& tm);
 
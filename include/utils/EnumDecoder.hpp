@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+namespace HotelManagement {
+
+// Text -> enum lookup through a perfect hash built at compile time. The
+// constructor searches for a seed under which every name lands in its own
+// slot, so decoding is one hash, one slot and one string compare.
+template<typename Enum, size_t N>
+class EnumDecoder {
+public:
+    struct Entry {
+        std::string_view name;
+        Enum value;
+    };
+
+    constexpr explicit EnumDecoder(const std::array<Entry, N>& entries) {
+        for (uint32_t candidate = 1; candidate < 100000; candidate++) {
+            if (tryBuild(entries, candidate)) {
+                seed = candidate;
+                return;
+            }
+        }
+        throw std::logic_error("EnumDecoder: no collision-free seed (duplicate names?)");
+    }
+
+    constexpr std::optional<Enum> decode(std::string_view text) const {
+        const Slot& slot = slots[hash(text, seed) & (TABLE_SIZE - 1)];
+        if (slot.used && slot.name == text) {
+            return slot.value;
+        }
+        return std::nullopt;
+    }
+
+    constexpr Enum decode(std::string_view text, Enum fallback) const {
+        return decode(text).value_or(fallback);
+    }
+
+private:
+    static constexpr size_t TABLE_SIZE = std::bit_ceil(N * 2);
+
+    struct Slot {
+        std::string_view name;
+        Enum value{};
+        bool used = false;
+    };
+
+    std::array<Slot, TABLE_SIZE> slots{};
+    uint32_t seed = 0;
+
+    // FNV-1a over the seed and the text
+    static constexpr uint32_t hash(std::string_view text, uint32_t seed) {
+        uint32_t h = 2166136261u ^ seed;
+        for (char c : text) {
+            h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+        }
+        return h ^ (h >> 15);
+    }
+
+    constexpr bool tryBuild(const std::array<Entry, N>& entries, uint32_t candidate) {
+        slots = {};
+        for (const Entry& entry : entries) {
+            Slot& slot = slots[hash(entry.name, candidate) & (TABLE_SIZE - 1)];
+            if (slot.used) {
+                return false;
+            }
+            slot = Slot{entry.name, entry.value, true};
+        }
+        return true;
+    }
+};
+
+} // namespace HotelManagement
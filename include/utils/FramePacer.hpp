@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace HotelManagement {
+
+// Decides when the render loop may block instead of drawing, caps the frame
+// rate, and measures what the loop costs. The window layer reports activity
+// (input, new data, a widget still in use); once nothing has happened for a
+// few frames the loop is idle and may wait for events.
+class FramePacer {
+public:
+    // Frame statistics over the last completed measuring window
+    struct Stats {
+        double fps = 0.0;
+        double frameMs = 0.0;    // mean time to build and submit a frame
+        double maxFrameMs = 0.0;
+        double cpuPercent = 0.0; // process CPU time (all threads) / wall time
+        double idlePercent = 0.0; // wall time spent blocked waiting for events
+        uint64_t totalFrames = 0;
+    };
+
+    // targetFps <= 0 leaves the rate to vsync. With idleWait off every
+    // frame is drawn, as before.
+    FramePacer(int targetFps, bool idleWait, std::chrono::milliseconds idleWakeup);
+
+    // Something on screen may change: draw the next few frames
+    void markActive();
+
+    // True when the loop should block for events rather than poll
+    bool isIdle() const { return idleWait && activeFrames == 0; }
+    // Longest block while idle, so clocks and hover delays still advance
+    double idleTimeoutSeconds() const;
+    // Bracket the blocking wait so idle time is accounted for
+    void beginWait();
+    void endWait();
+
+    // Sleep until the next frame may start under the frame cap
+    void waitForFrameSlot();
+
+    void beginFrame();
+    void endFrame();
+
+    const Stats& stats() const { return current; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const Clock::duration frameInterval; // zero = uncapped
+    const bool idleWait;
+    const std::chrono::milliseconds idleWakeup;
+
+    int activeFrames;
+    Clock::time_point nextFrame;
+    Clock::time_point frameStart;
+    Clock::time_point waitStart;
+
+    // Measuring window
+    Clock::time_point windowStart;
+    double windowCpuStart;
+    uint64_t windowFrames = 0;
+    double windowFrameMs = 0.0;
+    double windowMaxFrameMs = 0.0;
+    double windowIdleMs = 0.0;
+
+    Stats current;
+
+    void closeWindow(Clock::time_point now);
+};
+
+} // namespace HotelManagement
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+
+namespace HotelManagement {
+
+struct LogRotationOptions {
+    uint64_t maxBytes = 10ull * 1024 * 1024; // 0 = no size limit
+    bool daily = true;                       // also rotate at local midnight
+    int maxFiles = 7;                        // rotated files kept (0 = keep all)
+    bool compress = true;                    // gzip rotated files (needs zlib)
+};
+
+// Moves a full log file aside and hands the slow work (gzip, deleting old
+// files) to a background thread, so rotating only costs a rename on the
+// logging thread. Rotated files are named <stem>.<YYYY-MM-DD_HHMMSSmmm><ext>[.gz]
+// next to the active log.
+class LogRotator {
+public:
+    LogRotator(std::string logPath, const LogRotationOptions& options);
+    ~LogRotator();
+
+    // Track a freshly opened log file of the given size
+    void reset(uint64_t currentBytes, std::chrono::system_clock::time_point now);
+
+    // Account for bytes written; true once the file is due for rotation
+    bool recordWrite(uint64_t bytes, std::chrono::system_clock::time_point now);
+
+    // Rename the (closed) log file aside and queue it for compression and
+    // retention. Returns false if the rename failed.
+    bool rotate(std::chrono::system_clock::time_point now);
+
+    static bool isCompressionAvailable();
+
+    LogRotator(const LogRotator&) = delete;
+    LogRotator& operator=(const LogRotator&) = delete;
+
+private:
+    void workerLoop();
+    void compressFile(const std::string& path);
+    void enforceRetention();
+    std::string archivePath(std::chrono::system_clock::time_point now) const;
+
+    static std::chrono::system_clock::time_point nextLocalMidnight(std::chrono::system_clock::time_point now);
+
+    const std::string logPath;
+    const LogRotationOptions options;
+    std::string stem;      // directory + file name without extension
+    std::string extension; // e.g. ".log"
+
+    uint64_t bytesWritten = 0;
+    std::chrono::system_clock::time_point rotateAt;
+
+    std::mutex workMutex;
+    std::condition_variable workReady;
+    std::vector<std::string> pending;
+    bool stopping = false;
+    std::thread worker;
+};
+
+} // namespace HotelManagement
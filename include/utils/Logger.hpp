@@ -1,5 +1,6 @@
 #pragma once
 
+#include "utils/LogRotator.hpp"
 #include <string>
 #include <fstream>
 #include <mutex>
@@ -7,6 +8,8 @@
 #include <sstream>
 #include <chrono>
 #include <iomanip>
+#include <atomic>
+#include <cstdint>
 
 namespace HotelManagement {
 
@@ -17,6 +20,18 @@ enum class LogLevel {
     ERROR = 3
 };
 
+// What a producer does when the async queue is full
+enum class LogOverflowPolicy {
+    Block, // wait for the writer thread to make room
+    Drop   // discard the record and count it
+};
+
+struct AsyncLogOptions {
+    size_t queueCapacity = 8192; // rounded up to a power of two
+    std::chrono::milliseconds flushInterval{250};
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block;
+};
+
 class Logger {
 public:
     // Singleton instance
@@ -27,6 +42,19 @@ public:
 
     // Set minimum log level
     static void setLevel(LogLevel level);
+    static bool isEnabled(LogLevel level);
+
+    // Hand records to a background writer thread instead of writing on the
+    // caller's thread. The writer flushes every flushInterval, immediately
+    // after an ERROR, and on shutdown().
+    static void enableAsync(const AsyncLogOptions& options = AsyncLogOptions());
+
+    // Records discarded under LogOverflowPolicy::Drop
+    static uint64_t getDroppedCount();
+
+    // Rotate the log file by size and/or day; old files are compressed and
+    // pruned on a background thread
+    static void setRotation(const LogRotationOptions& options);
 
     // Logging methods
     static void debug(const std::string& message);
@@ -37,22 +65,30 @@ public:
     // Template for easier logging with multiple arguments
     template<typename... Args>
     static void debug(Args&&... args) {
-        log(LogLevel::DEBUG, formatMessage(std::forward<Args>(args)...));
+        if (isEnabled(LogLevel::DEBUG)) {
+            log(LogLevel::DEBUG, formatMessage(std::forward<Args>(args)...));
+        }
     }
 
     template<typename... Args>
     static void info(Args&&... args) {
-        log(LogLevel::INFO, formatMessage(std::forward<Args>(args)...));
+        if (isEnabled(LogLevel::INFO)) {
+            log(LogLevel::INFO, formatMessage(std::forward<Args>(args)...));
+        }
     }
 
     template<typename... Args>
     static void warning(Args&&... args) {
-        log(LogLevel::WARNING, formatMessage(std::forward<Args>(args)...));
+        if (isEnabled(LogLevel::WARNING)) {
+            log(LogLevel::WARNING, formatMessage(std::forward<Args>(args)...));
+        }
     }
 
     template<typename... Args>
     static void error(Args&&... args) {
-        log(LogLevel::ERROR, formatMessage(std::forward<Args>(args)...));
+        if (isEnabled(LogLevel::ERROR)) {
+            log(LogLevel::ERROR, formatMessage(std::forward<Args>(args)...));
+        }
     }
 
     // Close log file
@@ -66,15 +102,24 @@ private:
     Logger() = default;
     ~Logger();
 
+    struct AsyncState;
+
     void initImpl(const std::string& filename);
     void setLevelImpl(LogLevel level);
+    void enableAsyncImpl(const AsyncLogOptions& options);
+    void setRotationImpl(const LogRotationOptions& options);
+    void rotateFile(std::chrono::system_clock::time_point now); // logMutex held
     void logImpl(LogLevel level, const std::string& message);
+    void writeEntry(LogLevel level, const std::string& entry); // logMutex held
+    void writerLoop();
+    void stopWriter();
     void shutdownImpl();
 
     static void log(LogLevel level, const std::string& message);
 
     // Helper to format current timestamp
     static std::string getCurrentTimestamp();
+    static std::string formatTimestamp(std::chrono::system_clock::time_point time);
 
     // Helper to convert log level to string
     static std::string levelToString(LogLevel level);
@@ -88,9 +133,16 @@ private:
     }
 
     std::ofstream logFile;
-    LogLevel currentLevel = LogLevel::INFO;
+    std::string logPath;
+    std::unique_ptr<LogRotator> rotator;
+    std::atomic<LogLevel> currentLevel{LogLevel::INFO};
     std::mutex logMutex;
     bool initialized = false;
+
+    std::unique_ptr<AsyncState> async;
+    std::atomic<bool> asyncRunning{false};
+    std::atomic<int> asyncProducers{0}; // logImpl calls that may push to the queue
+    std::atomic<uint64_t> droppedCount{0};
 };
 
 } // namespace HotelManagement
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace HotelManagement {
+
+// Read-only memory mapping of a whole file. Pages are faulted in on demand;
+// release() hands back ranges that have been consumed so scanning a large
+// file keeps a bounded resident set.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return opened; }
+    size_t size() const { return length; }
+    std::string_view view() const { return std::string_view(data, length); }
+
+    // Hint that [offset, offset + count) will not be read again
+    void release(size_t offset, size_t count) const;
+
+    const std::string& getLastError() const { return lastError; }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+private:
+    const char* data = nullptr;
+    size_t length = 0;
+    bool opened = false;
+    std::string lastError;
+
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+} // namespace HotelManagement
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "utils/ThreadPool.hpp"
+#include <algorithm>
+#include <future>
+#include <vector>
+
+namespace HotelManagement {
+
+// Inputs shorter than this per worker are sorted on the calling thread
+constexpr size_t PARALLEL_SORT_MIN_SLICE = 16384;
+
+// Sort on the pool's workers: equal slices are sorted in parallel, then
+// merged pairwise level by level, each level's merges also in parallel.
+// Blocks until done, so never call it from one of the pool's own workers;
+// compare must not throw.
+template<typename T, typename Compare>
+void parallelSort(ThreadPool& pool, std::vector<T>& values, Compare compare,
+                  size_t minSlice = PARALLEL_SORT_MIN_SLICE) {
+    // A power of two, so every slice has a partner at each merge level
+    size_t sliceCount = 1;
+    while (sliceCount * 2 <= pool.size() && values.size() / (sliceCount * 2) >= minSlice) {
+        sliceCount *= 2;
+    }
+    if (sliceCount == 1) {
+        std::sort(values.begin(), values.end(), compare);
+        return;
+    }
+
+    std::vector<size_t> bounds(sliceCount + 1);
+    for (size_t i = 0; i <= sliceCount; i++) {
+        bounds[i] = values.size() * i / sliceCount;
+    }
+
+    std::vector<std::future<void>> pending;
+    for (size_t i = 0; i < sliceCount; i++) {
+        pending.push_back(pool.submit([&values, &compare, first = bounds[i], last = bounds[i + 1]]() {
+            std::sort(values.begin() + first, values.begin() + last, compare);
+        }));
+    }
+    for (auto& task : pending) {
+        task.get();
+    }
+
+    std::vector<T> merged(values.size());
+    for (size_t width = 1; width < sliceCount; width *= 2) {
+        pending.clear();
+        for (size_t i = 0; i < sliceCount; i += 2 * width) {
+            size_t first = bounds[i];
+            size_t middle = bounds[i + width];
+            size_t last = bounds[i + 2 * width];
+            pending.push_back(pool.submit([&values, &merged, &compare, first, middle, last]() {
+                std::merge(values.begin() + first, values.begin() + middle,
+                           values.begin() + middle, values.begin() + last,
+                           merged.begin() + first, compare);
+            }));
+        }
+        for (auto& task : pending) {
+            task.get();
+        }
+        values.swap(merged);
+    }
+}
+
+} // namespace HotelManagement
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace HotelManagement {
+
+// Fixed-capacity ring of the most recent values. Storage never grows, so
+// recording costs the same however long the program runs.
+template<typename T, size_t Capacity>
+class RingBuffer {
+public:
+    void push(T value) {
+        values[next] = value;
+        next = (next + 1) % Capacity;
+        if (count < Capacity) count++;
+    }
+
+    size_t size() const { return count; }
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Raw storage with the oldest value at start(), for plotting
+    const T* data() const { return values.data(); }
+    size_t start() const { return count < Capacity ? 0 : next; }
+
+    // i = 0 is the oldest value
+    const T& operator[](size_t i) const { return values[(start() + i) % Capacity]; }
+    const T& latest() const { return values[(next + Capacity - 1) % Capacity]; }
+
+private:
+    std::array<T, Capacity> values{};
+    size_t next = 0;
+    size_t count = 0;
+};
+
+// Parts of one main loop iteration
+enum class FramePhase { Events, Update, BuildUi, Submit };
+constexpr size_t FRAME_PHASE_COUNT = 4;
+
+// Where frames and database calls spend their time. Frame phases are
+// recorded by the main thread; query latencies by any thread.
+class Profiler {
+public:
+    static constexpr size_t FRAME_HISTORY = 600;
+    static constexpr size_t QUERY_HISTORY = 256;
+
+    using FrameRing = RingBuffer<float, FRAME_HISTORY>;
+
+    struct QuerySeries {
+        std::string name; // Class::method of the caller
+        RingBuffer<float, QUERY_HISTORY> latencyMs;
+        uint64_t calls = 0;
+        double totalMs = 0.0;
+        float maxMs = 0.0f;
+    };
+
+    static const char* phaseName(FramePhase phase);
+
+    // Main thread: phases add up until endFrame() files the frame
+    void addPhase(FramePhase phase, double ms);
+    void endFrame();
+    const FrameRing& phaseHistory(FramePhase phase) const { return phases[static_cast<size_t>(phase)]; }
+    const FrameRing& frameHistory() const { return totals; }
+
+    // Any thread. caller is std::source_location::function_name() of the
+    // repository method that ran the query.
+    void recordQuery(const char* caller, double ms);
+
+    // Copy of every query series in first-seen order, for drawing
+    std::vector<QuerySeries> querySeries() const;
+
+private:
+    std::array<double, FRAME_PHASE_COUNT> currentFrame{};
+    std::array<FrameRing, FRAME_PHASE_COUNT> phases;
+    FrameRing totals;
+
+    mutable std::mutex queryMutex;
+    std::vector<QuerySeries> queries;
+    std::unordered_map<const char*, size_t> seriesByCaller; // function_name() pointers
+    std::unordered_map<std::string, size_t> seriesByName;   // lambdas share their method's series
+};
+
+// Adds the time until destruction to a frame phase; no-op without a profiler
+class ScopedPhase {
+public:
+    ScopedPhase(Profiler* profiler, FramePhase phase)
+        : profiler(profiler), phase(phase), start(std::chrono::steady_clock::now()) {}
+    ~ScopedPhase() {
+        if (profiler) {
+            profiler->addPhase(phase, std::chrono::duration<double, std::milli>(
+                                          std::chrono::steady_clock::now() - start).count());
+        }
+    }
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+private:
+    Profiler* profiler;
+    FramePhase phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+// Records one database call's latency, including failed ones
+class ScopedQueryTimer {
+public:
+    ScopedQueryTimer(Profiler* profiler, const std::source_location& caller)
+        : profiler(profiler), caller(caller.function_name()), start(std::chrono::steady_clock::now()) {}
+    ~ScopedQueryTimer() {
+        if (profiler) {
+            profiler->recordQuery(caller, std::chrono::duration<double, std::milli>(
+                                              std::chrono::steady_clock::now() - start).count());
+        }
+    }
+
+    ScopedQueryTimer(const ScopedQueryTimer&) = delete;
+    ScopedQueryTimer& operator=(const ScopedQueryTimer&) = delete;
+
+private:
+    Profiler* profiler;
+    const char* caller;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace HotelManagement
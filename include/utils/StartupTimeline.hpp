@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace HotelManagement {
+
+// Wall-clock phases of program startup, recorded from any thread and
+// logged once as a timeline: offset from the start, duration and thread.
+// Phases may overlap; the total is when the last one finished.
+class StartupTimeline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Times its own scope as one phase
+    class Phase {
+    public:
+        Phase(StartupTimeline& timeline, std::string name)
+            : timeline(timeline), name(std::move(name)), start(Clock::now()) {}
+        ~Phase() { timeline.record(std::move(name), start, Clock::now()); }
+
+        Phase(const Phase&) = delete;
+        Phase& operator=(const Phase&) = delete;
+
+    private:
+        StartupTimeline& timeline;
+        std::string name;
+        Clock::time_point start;
+    };
+
+    // Starts the clock; the constructing thread is logged as "main"
+    StartupTimeline();
+
+    void record(std::string name, Clock::time_point start, Clock::time_point end);
+
+    // Log every phase in start order, then the total
+    void log() const;
+
+private:
+    struct Entry {
+        std::string name;
+        Clock::time_point start;
+        Clock::time_point end;
+        std::thread::id thread;
+    };
+
+    const Clock::time_point origin;
+    const std::thread::id mainThread;
+    mutable std::mutex mutex;
+    std::vector<Entry> entries;
+};
+
+} // namespace HotelManagement
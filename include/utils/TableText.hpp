@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace HotelManagement {
+
+// Display text of a table, formatted once and drawn many times. Cells are
+// NUL-terminated strings packed back to back into one buffer, so a frame
+// hands out pointers instead of building strings.
+class TableText {
+public:
+    explicit TableText(size_t columnCount = 1);
+
+    void reserve(size_t rowCount, size_t bytesPerRow);
+
+    // Append a row; missing cells are left empty and extra ones ignored.
+    // Throws std::length_error past 4 GB of text.
+    void addRow(std::initializer_list<std::string_view> cells);
+
+    const char* cell(size_t row, size_t column) const {
+        return text.data() + offsets[row * columns + column];
+    }
+
+    size_t rowCount() const { return offsets.size() / columns; }
+    size_t columnCount() const { return columns; }
+
+private:
+    size_t columns;
+    std::string text;
+    std::vector<uint32_t> offsets; // by row * columns + column
+};
+
+} // namespace HotelManagement
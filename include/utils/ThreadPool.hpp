@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+namespace HotelManagement {
+
+// Fixed set of worker threads draining a FIFO task queue. Tasks still queued
+// when the pool is destroyed are run before the workers exit.
+class ThreadPool {
+public:
+    // 0 = one thread per hardware thread
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    // Queue a task; the future carries its result or exception
+    template<typename Func>
+    auto submit(Func&& func) -> std::future<std::invoke_result_t<std::decay_t<Func>>> {
+        using Result = std::invoke_result_t<std::decay_t<Func>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+        std::future<Result> future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            tasks.emplace_back([task]() { (*task)(); });
+        }
+        taskReady.notify_one();
+        return future;
+    }
+
+    size_t size() const { return workers.size(); }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex queueMutex;
+    std::condition_variable taskReady;
+    bool stopping = false;
+
+    void workerLoop();
+};
+
+} // namespace HotelManagement
@@ -0,0 +1,383 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace HotelManagement {
+
+// Snapshot of a cache's counters
+struct CacheStats {
+    size_t entries = 0;
+    size_t bytes = 0;
+    size_t capacityBytes = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t rejections = 0; // new entries refused by the admission filter
+    uint64_t invalidations = 0;
+
+    double hitRate() const {
+        uint64_t lookups = hits + misses;
+        return lookups > 0 ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+    }
+};
+
+// Approximate access counts of recently seen keys: a count-min sketch of
+// 4-bit counters. All counters are halved once enough increments have
+// accumulated, so popularity fades unless it is renewed.
+class FrequencySketch {
+public:
+    explicit FrequencySketch(size_t expectedEntries) {
+        size_t words = 8;
+        while (words < expectedEntries && words < MAX_WORDS) {
+            words <<= 1;
+        }
+        table.assign(words, 0);
+        counterMask = words * COUNTERS_PER_WORD - 1;
+        sampleSize = words * 10;
+    }
+
+    void increment(uint64_t hash) {
+        bool added = false;
+        for (int i = 0; i < DEPTH; ++i) {
+            size_t counter = counterIndex(hash, i);
+            uint64_t& word = table[counter / COUNTERS_PER_WORD];
+            int shift = static_cast<int>(counter % COUNTERS_PER_WORD) * 4;
+            if (((word >> shift) & 0xF) < 0xF) {
+                word += uint64_t{1} << shift;
+                added = true;
+            }
+        }
+        if (added && ++additions >= sampleSize) {
+            age();
+        }
+    }
+
+    int estimate(uint64_t hash) const {
+        int frequency = 0xF;
+        for (int i = 0; i < DEPTH; ++i) {
+            size_t counter = counterIndex(hash, i);
+            int shift = static_cast<int>(counter % COUNTERS_PER_WORD) * 4;
+            frequency = std::min(frequency, static_cast<int>((table[counter / COUNTERS_PER_WORD] >> shift) & 0xF));
+        }
+        return frequency;
+    }
+
+private:
+    static constexpr int DEPTH = 4;
+    static constexpr size_t COUNTERS_PER_WORD = 16;
+    static constexpr size_t MAX_WORDS = size_t{1} << 16;
+    static constexpr uint64_t SEEDS[DEPTH] = {
+        0xC3A5C85C97CB3127ULL, 0xB492B66FBE98F273ULL, 0x9AE16A3B2F90404FULL, 0xCBF29CE484222325ULL};
+
+    std::vector<uint64_t> table;
+    size_t counterMask = 0;
+    size_t sampleSize = 0;
+    size_t additions = 0;
+
+    size_t counterIndex(uint64_t hash, int i) const {
+        uint64_t h = (hash + SEEDS[i]) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 32;
+        return static_cast<size_t>(h) & counterMask;
+    }
+
+    void age() {
+        for (uint64_t& word : table) {
+            word = (word >> 1) & 0x7777777777777777ULL;
+        }
+        additions /= 2;
+    }
+};
+
+// Sharded, thread-safe cache bounded by an approximate byte budget, using
+// the W-TinyLFU policy: new entries enter a small LRU window; entries
+// leaving the window are admitted into the main segmented LRU only if the
+// frequency sketch rates them above the entry they would evict. A one-off
+// scan therefore cannot flush the frequently used entries.
+//
+// heapBytes reports the memory a value owns outside its own object (string
+// buffers and the like); node and index overhead is added per entry.
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class TinyLfuCache {
+public:
+    using HeapBytes = std::function<size_t(const Value&)>;
+    using Loader = std::function<std::optional<Value>()>;
+
+    explicit TinyLfuCache(size_t maxBytes, HeapBytes heapBytes = {}, size_t shardCount = 16)
+        : maxBytes(maxBytes), heapBytes(std::move(heapBytes)) {
+        shardCount = std::max<size_t>(1, shardCount);
+        size_t shardBytes = maxBytes / shardCount;
+        for (size_t i = 0; i < shardCount; ++i) {
+            shards.push_back(std::make_unique<Shard>(shardBytes));
+        }
+    }
+
+    TinyLfuCache(const TinyLfuCache&) = delete;
+    TinyLfuCache& operator=(const TinyLfuCache&) = delete;
+
+    std::optional<Value> get(const Key& key) {
+        uint64_t hash = spread(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return lookup(shard, key, hash);
+    }
+
+    void put(const Key& key, const Value& value) {
+        uint64_t hash = spread(key);
+        Shard& shard = shardFor(hash);
+        size_t bytes = entryBytes(value);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        insert(shard, key, hash, value, bytes);
+    }
+
+    // Cached value, or the result of load() which is offered to the cache if
+    // present. A value loaded while its shard saw an erase or clear is
+    // returned but not cached, so a concurrent change can never be masked by
+    // a stale row.
+    std::optional<Value> getOrLoad(const Key& key, const Loader& load) {
+        uint64_t hash = spread(key);
+        Shard& shard = shardFor(hash);
+        uint64_t generation;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (auto cached = lookup(shard, key, hash)) {
+                return cached;
+            }
+            generation = shard.generation;
+        }
+
+        std::optional<Value> value = load();
+        if (value.has_value()) {
+            size_t bytes = entryBytes(*value);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (generation == shard.generation) {
+                insert(shard, key, hash, *value, bytes);
+            }
+        }
+        return value;
+    }
+
+    void erase(const Key& key) {
+        uint64_t hash = spread(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            remove(shard, it->second);
+        }
+        shard.generation++;
+        shard.invalidations++;
+    }
+
+    void clear() {
+        for (auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->index.clear();
+            shard->window.clear();
+            shard->probation.clear();
+            shard->protectedList.clear();
+            shard->windowBytes = shard->probationBytes = shard->protectedBytes = 0;
+            shard->generation++;
+        }
+        clears++;
+    }
+
+    CacheStats getStats() const {
+        CacheStats stats;
+        stats.capacityBytes = maxBytes;
+        stats.invalidations = clears.load();
+        for (const auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            stats.entries += shard->index.size();
+            stats.bytes += shard->windowBytes + shard->probationBytes + shard->protectedBytes;
+            stats.hits += shard->hits;
+            stats.misses += shard->misses;
+            stats.evictions += shard->evictions;
+            stats.rejections += shard->rejections;
+            stats.invalidations += shard->invalidations;
+        }
+        return stats;
+    }
+
+private:
+    enum class Segment : uint8_t { Window, Probation, Protected };
+
+    struct Node {
+        Key key;
+        Value value;
+        uint64_t hash;
+        size_t bytes;
+        Segment segment;
+    };
+
+    using NodeList = std::list<Node>;
+    using NodeIterator = typename NodeList::iterator;
+
+    // Window takes 1% of a shard's budget; the protected segment up to 80% of the rest
+    struct Shard {
+        explicit Shard(size_t budget)
+            : windowBudget(budget / 100),
+              mainBudget(budget - budget / 100),
+              protectedBudget(mainBudget / 5 * 4),
+              sketch(budget / ENTRY_OVERHEAD) {}
+
+        mutable std::mutex mutex;
+        std::unordered_map<Key, NodeIterator, Hash> index;
+        NodeList window;
+        NodeList probation;
+        NodeList protectedList;
+        size_t windowBytes = 0;
+        size_t probationBytes = 0;
+        size_t protectedBytes = 0;
+        const size_t windowBudget;
+        const size_t mainBudget;
+        const size_t protectedBudget;
+        FrequencySketch sketch;
+        uint64_t generation = 0;
+
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        uint64_t rejections = 0;
+        uint64_t invalidations = 0;
+    };
+
+    // List links plus the index node and its bucket slot
+    static constexpr size_t ENTRY_OVERHEAD =
+        sizeof(Node) + 2 * sizeof(void*) + sizeof(std::pair<const Key, NodeIterator>) + 3 * sizeof(void*);
+
+    const size_t maxBytes;
+    const HeapBytes heapBytes;
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::atomic<uint64_t> clears{0};
+
+    uint64_t spread(const Key& key) const {
+        uint64_t h = static_cast<uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        return h ^ (h >> 29);
+    }
+
+    Shard& shardFor(uint64_t hash) {
+        return *shards[(hash >> 32) % shards.size()];
+    }
+
+    size_t entryBytes(const Value& value) const {
+        return ENTRY_OVERHEAD + (heapBytes ? heapBytes(value) : 0);
+    }
+
+    std::optional<Value> lookup(Shard& shard, const Key& key, uint64_t hash) {
+        shard.sketch.increment(hash);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            shard.misses++;
+            return std::nullopt;
+        }
+        shard.hits++;
+        touch(shard, it->second);
+        return it->second->value;
+    }
+
+    // Record a hit: probation entries are promoted, the rest move to the front
+    void touch(Shard& shard, NodeIterator node) {
+        switch (node->segment) {
+        case Segment::Window:
+            shard.window.splice(shard.window.begin(), shard.window, node);
+            break;
+        case Segment::Probation:
+            shard.probationBytes -= node->bytes;
+            shard.protectedBytes += node->bytes;
+            shard.protectedList.splice(shard.protectedList.begin(), shard.probation, node);
+            node->segment = Segment::Protected;
+            while (shard.protectedBytes > shard.protectedBudget && shard.protectedList.size() > 1) {
+                NodeIterator demoted = std::prev(shard.protectedList.end());
+                shard.protectedBytes -= demoted->bytes;
+                shard.probationBytes += demoted->bytes;
+                shard.probation.splice(shard.probation.begin(), shard.protectedList, demoted);
+                demoted->segment = Segment::Probation;
+            }
+            break;
+        case Segment::Protected:
+            shard.protectedList.splice(shard.protectedList.begin(), shard.protectedList, node);
+            break;
+        }
+    }
+
+    void insert(Shard& shard, const Key& key, uint64_t hash, const Value& value, size_t bytes) {
+        auto existing = shard.index.find(key);
+        if (existing != shard.index.end()) {
+            remove(shard, existing->second);
+        }
+        if (bytes > shard.windowBudget + shard.mainBudget) {
+            shard.rejections++;
+            return;
+        }
+
+        shard.window.push_front(Node{key, value, hash, bytes, Segment::Window});
+        shard.index.emplace(key, shard.window.begin());
+        shard.windowBytes += bytes;
+
+        while (shard.windowBytes > shard.windowBudget && !shard.window.empty()) {
+            NodeIterator candidate = std::prev(shard.window.end());
+            shard.windowBytes -= candidate->bytes;
+            shard.probationBytes += candidate->bytes;
+            shard.probation.splice(shard.probation.begin(), shard.window, candidate);
+            candidate->segment = Segment::Probation;
+            admit(shard, candidate);
+        }
+    }
+
+    // The candidate has just joined probation; make room in the main
+    // segment, keeping whichever of candidate and victim is used more often
+    void admit(Shard& shard, NodeIterator candidate) {
+        while (shard.probationBytes + shard.protectedBytes > shard.mainBudget) {
+            NodeIterator victim;
+            if (std::prev(shard.probation.end()) != candidate) {
+                victim = std::prev(shard.probation.end());
+            } else if (!shard.protectedList.empty()) {
+                victim = std::prev(shard.protectedList.end());
+            } else {
+                remove(shard, candidate);
+                shard.rejections++;
+                return;
+            }
+
+            if (shard.sketch.estimate(candidate->hash) > shard.sketch.estimate(victim->hash)) {
+                remove(shard, victim);
+                shard.evictions++;
+            } else {
+                remove(shard, candidate);
+                shard.rejections++;
+                return;
+            }
+        }
+    }
+
+    void remove(Shard& shard, NodeIterator node) {
+        switch (node->segment) {
+        case Segment::Window:
+            shard.windowBytes -= node->bytes;
+            shard.index.erase(node->key);
+            shard.window.erase(node);
+            break;
+        case Segment::Probation:
+            shard.probationBytes -= node->bytes;
+            shard.index.erase(node->key);
+            shard.probation.erase(node);
+            break;
+        case Segment::Protected:
+            shard.protectedBytes -= node->bytes;
+            shard.index.erase(node->key);
+            shard.protectedList.erase(node);
+            break;
+        }
+    }
+};
+
+} // namespace HotelManagement
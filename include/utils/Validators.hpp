@@ -1,7 +1,6 @@
 #pragma once
 
 #include <string>
-#include <regex>
 
 namespace HotelManagement {
 
@@ -69,10 +68,6 @@ public:
 
     // Booking reference validation
     static bool isValidBookingReference(const std::string& reference);
-
-private:
-    // Helper: Check if string matches regex pattern
-    static bool matchesPattern(const std::string& str, const std::string& pattern);
 };
 
 } // namespace HotelManagement
@@ -19,6 +19,8 @@ DROP VIEW IF EXISTS booking_revenue_view;
 
 -- Drop functions if they exist
 DROP FUNCTION IF EXISTS update_updated_at_column() CASCADE;
+DROP FUNCTION IF EXISTS notify_row_changed() CASCADE;
+DROP FUNCTION IF EXISTS notify_rows_inserted() CASCADE;
 
 -- ==========================================
 -- TABLE DEFINITIONS
@@ -54,7 +56,7 @@ CREATE TABLE rooms (
 
 CREATE INDEX idx_rooms_status ON rooms(status);
 CREATE INDEX idx_rooms_type ON rooms(room_type_id);
-CREATE INDEX idx_rooms_floor ON rooms(floor_number);
+CREATE INDEX idx_rooms_floor ON rooms(floor_number, room_number);
 
 COMMENT ON TABLE rooms IS 'Individual hotel rooms with their current status';
 COMMENT ON COLUMN rooms.status IS 'Current room status: available, occupied, maintenance, or reserved';
@@ -79,9 +81,22 @@ CREATE TABLE guests (
 
 CREATE INDEX idx_guests_email ON guests(email);
 CREATE INDEX idx_guests_phone ON guests(phone);
-CREATE INDEX idx_guests_name ON guests(last_name, first_name);
+CREATE INDEX idx_guests_name ON guests(last_name, first_name, id);
 CREATE INDEX idx_guests_vip ON guests(vip_status);
 
+-- Trigram indexes let the name search's ILIKE '%...%' avoid a sequential scan
+-- until the application's in-memory search index is loaded. pg_trgm is a
+-- contrib extension; without it (or the right to create it) this is skipped.
+DO $$
+BEGIN
+    CREATE EXTENSION IF NOT EXISTS pg_trgm;
+    CREATE INDEX idx_guests_first_name_trgm ON guests USING gin (first_name gin_trgm_ops);
+    CREATE INDEX idx_guests_last_name_trgm ON guests USING gin (last_name gin_trgm_ops);
+EXCEPTION WHEN OTHERS THEN
+    RAISE NOTICE 'pg_trgm unavailable, guest name search will scan: %', SQLERRM;
+END;
+$$;
+
 COMMENT ON TABLE guests IS 'Guest information and profiles';
 COMMENT ON COLUMN guests.preferences IS 'JSON object for guest preferences (smoking, floor, pillows, etc.)';
 
@@ -110,7 +125,7 @@ CREATE INDEX idx_bookings_guest ON bookings(guest_id);
 CREATE INDEX idx_bookings_room ON bookings(room_id);
 CREATE INDEX idx_bookings_dates ON bookings(check_in_date, check_out_date);
 CREATE INDEX idx_bookings_status ON bookings(status);
-CREATE INDEX idx_bookings_check_in ON bookings(check_in_date);
+CREATE INDEX idx_bookings_check_in ON bookings(check_in_date, id);
 CREATE INDEX idx_bookings_check_out ON bookings(check_out_date);
 
 COMMENT ON TABLE bookings IS 'Hotel reservations and bookings';
@@ -306,6 +321,100 @@ CREATE TRIGGER update_bookings_updated_at
     BEFORE UPDATE ON bookings
     FOR EACH ROW EXECUTE FUNCTION update_updated_at_column();
 
+-- Function to announce row changes to application caches.
+-- Sends NOTIFY <table>_changed with the row id as payload (empty payload =
+-- whole table, e.g. after TRUNCATE). Notifications are delivered on commit.
+CREATE OR REPLACE FUNCTION notify_row_changed()
+RETURNS TRIGGER AS $$
+BEGIN
+    IF TG_LEVEL = 'STATEMENT' THEN
+        PERFORM pg_notify(TG_TABLE_NAME || '_changed', '');
+    ELSE
+        PERFORM pg_notify(TG_TABLE_NAME || '_changed', OLD.id::text);
+    END IF;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+-- Cached tables: inserts need no invalidation, so only updates and deletes notify
+CREATE TRIGGER notify_room_types_changed
+    AFTER UPDATE OR DELETE ON room_types
+    FOR EACH ROW EXECUTE FUNCTION notify_row_changed();
+
+CREATE TRIGGER notify_room_types_truncated
+    AFTER TRUNCATE ON room_types
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_row_changed();
+
+CREATE TRIGGER notify_rooms_changed
+    AFTER UPDATE OR DELETE ON rooms
+    FOR EACH ROW EXECUTE FUNCTION notify_row_changed();
+
+CREATE TRIGGER notify_rooms_truncated
+    AFTER TRUNCATE ON rooms
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_row_changed();
+
+CREATE TRIGGER notify_guests_changed
+    AFTER UPDATE OR DELETE ON guests
+    FOR EACH ROW EXECUTE FUNCTION notify_row_changed();
+
+CREATE TRIGGER notify_guests_truncated
+    AFTER TRUNCATE ON guests
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_row_changed();
+
+-- Function to announce new rows once per statement (cheap for COPY imports).
+-- Sends NOTIFY <table>_inserted with the new ids, comma-separated and split
+-- to stay under the 8000-byte payload limit. A statement inserting more than
+-- 10000 rows sends one empty payload instead: reload the whole table.
+CREATE OR REPLACE FUNCTION notify_rows_inserted()
+RETURNS TRIGGER AS $$
+DECLARE
+    channel TEXT := TG_TABLE_NAME || '_inserted';
+    ids TEXT;
+BEGIN
+    IF (SELECT COUNT(*) FROM inserted_rows) > 10000 THEN
+        PERFORM pg_notify(channel, '');
+        RETURN NULL;
+    END IF;
+
+    FOR ids IN
+        SELECT string_agg(id::text, ',')
+        FROM (SELECT id, (row_number() OVER (ORDER BY id) - 1) / 500 AS chunk FROM inserted_rows) numbered
+        GROUP BY chunk
+    LOOP
+        PERFORM pg_notify(channel, ids);
+    END LOOP;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE TRIGGER notify_room_types_inserted
+    AFTER INSERT ON room_types
+    REFERENCING NEW TABLE AS inserted_rows
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_rows_inserted();
+
+CREATE TRIGGER notify_rooms_inserted
+    AFTER INSERT ON rooms
+    REFERENCING NEW TABLE AS inserted_rows
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_rows_inserted();
+
+CREATE TRIGGER notify_guests_inserted
+    AFTER INSERT ON guests
+    REFERENCING NEW TABLE AS inserted_rows
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_rows_inserted();
+
+CREATE TRIGGER notify_bookings_inserted
+    AFTER INSERT ON bookings
+    REFERENCING NEW TABLE AS inserted_rows
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_rows_inserted();
+
+CREATE TRIGGER notify_bookings_changed
+    AFTER UPDATE OR DELETE ON bookings
+    FOR EACH ROW EXECUTE FUNCTION notify_row_changed();
+
+CREATE TRIGGER notify_bookings_truncated
+    AFTER TRUNCATE ON bookings
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_row_changed();
+
 -- ==========================================
 -- GRANT PERMISSIONS (adjust user as needed)
 -- ==========================================
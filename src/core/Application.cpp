@@ -1,12 +1,138 @@
 #include "core/Application.hpp"
 #include "utils/Logger.hpp"
+#include "utils/DateUtils.hpp"
 #include <GLFW/glfw3.h>
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
+#include <implot.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <future>
+#include <iterator>
 
 namespace HotelManagement {
 
+namespace {
+
+// Suggestions shown under a filter box
+constexpr size_t AUTOCOMPLETE_LIMIT = 8;
+constexpr float FILTER_WIDTH = 240.0f;
+
+constexpr float STATUS_FILTER_WIDTH = 140.0f;
+
+// Status filter choices; entry i > 0 selects enum value i - 1
+constexpr const char* ROOM_STATUS_OPTIONS[] = {"Any status", "Available", "Occupied", "Maintenance", "Reserved"};
+constexpr const char* GUEST_STATUS_OPTIONS[] = {"All guests", "VIP", "Not VIP"};
+constexpr const char* BOOKING_STATUS_OPTIONS[] = {"Any status", "Pending", "Confirmed", "Checked in",
+                                                  "Checked out", "Cancelled"};
+
+// List tables scroll inside the view with their header row pinned. Headers
+// sort on click (shift-click adds columns); a third click restores the
+// table order.
+constexpr ImGuiTableFlags LIST_TABLE_FLAGS = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                                             ImGuiTableFlags_ScrollY | ImGuiTableFlags_Sortable |
+                                             ImGuiTableFlags_SortMulti | ImGuiTableFlags_SortTristate;
+
+void drawCells(const TableText& text, size_t row) {
+    for (size_t column = 0; column < text.columnCount(); column++) {
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(text.cell(row, column));
+    }
+}
+
+// Numeric room numbers sort by value ("99" before "101"), the rest as text
+SortValue roomNumberValue(const std::string& number) {
+    if (number.empty() || number.size() > 18 ||
+        !std::all_of(number.begin(), number.end(), [](unsigned char c) { return std::isdigit(c); })) {
+        return std::string_view(number);
+    }
+    return static_cast<int64_t>(std::stoll(number));
+}
+
+bool startsWithIgnoreCase(std::string_view text, std::string_view prefix) {
+    if (prefix.size() > text.size()) return false;
+    for (size_t i = 0; i < prefix.size(); i++) {
+        unsigned char a = static_cast<unsigned char>(text[i]);
+        unsigned char b = static_cast<unsigned char>(prefix[i]);
+        if (std::tolower(a) != std::tolower(b)) return false;
+    }
+    return true;
+}
+
+// Row filters and sort values of the list views. They run on a background
+// thread and see only the table and the filter values they are given.
+bool roomMatches(const TableData<Room>& table, size_t row, std::string_view text, int status) {
+    const Room& room = table.entities[row];
+    return (status == 0 || static_cast<int>(room.status) == status - 1) &&
+           startsWithIgnoreCase(room.roomNumber, text);
+}
+
+SortValue roomSortValue(const TableData<Room>& table, int column, size_t row) {
+    const Room& room = table.entities[row];
+    switch (column) {
+        case 0: return roomNumberValue(room.roomNumber);
+        case 1: return int64_t{room.floorNumber};
+        case 2: return int64_t{room.roomTypeId};
+        case 3: return static_cast<int64_t>(room.status);
+        default: return int64_t{0};
+    }
+}
+
+bool guestMatches(const TableData<Guest>& table, size_t row, std::string_view text, int status) {
+    const Guest& guest = table.entities[row];
+    return (status == 0 || guest.vipStatus == (status == 1)) &&
+           (startsWithIgnoreCase(guest.firstName, text) ||
+            startsWithIgnoreCase(guest.lastName, text) ||
+            startsWithIgnoreCase(table.rows.cell(row, 1), text)); // full name
+}
+
+SortValue guestSortValue(const TableData<Guest>& table, int column, size_t row) {
+    const Guest& guest = table.entities[row];
+    switch (column) {
+        case 0: return int64_t{guest.id};
+        case 1: return std::string_view(guest.lastName);
+        case 2: return std::string_view(guest.email);
+        case 3: return std::string_view(guest.phone);
+        case 4: return int64_t{guest.vipStatus};
+        default: return int64_t{0};
+    }
+}
+
+bool bookingMatches(const TableData<Booking>& table, size_t row, std::string_view text, int status) {
+    return (status == 0 || static_cast<int>(table.entities[row].status) == status - 1) &&
+           (startsWithIgnoreCase(table.rows.cell(row, 0), text) ||
+            startsWithIgnoreCase(table.rows.cell(row, 1), text) ||
+            startsWithIgnoreCase(table.rows.cell(row, 2), text));
+}
+
+SortValue bookingSortValue(const TableData<Booking>& table, int column, size_t row) {
+    const Booking& booking = table.entities[row];
+    switch (column) {
+        case 0: return int64_t{booking.id};
+        case 1: return int64_t{booking.guestId};
+        case 2: return int64_t{booking.roomId};
+        case 3: return int64_t{booking.checkInDate.daysSinceEpoch()};
+        case 4: return int64_t{booking.checkOutDate.daysSinceEpoch()};
+        case 5: return static_cast<int64_t>(booking.status);
+        default: return int64_t{0};
+    }
+}
+
+size_t megabytes(int mb) {
+    return static_cast<size_t>(std::max(0, mb)) << 20;
+}
+
+void logCacheStats(const char* name, const CacheStats& stats) {
+    Logger::info("Cache ", name, ": ", stats.entries, " entries, ", stats.bytes >> 10, " of ",
+                 stats.capacityBytes >> 10, " KB, hit rate ", stats.hitRate() * 100.0, "%, ",
+                 stats.evictions, " evictions, ", stats.rejections, " rejections, ",
+                 stats.invalidations, " invalidations");
+}
+
+} // namespace
+
 Application::Application() {}
 
 Application::~Application() {
@@ -21,27 +147,51 @@ bool Application::initialize() {
         Logger::warning("Could not load config file, using defaults");
     }
 
+    initLogging();
+
     windowWidth = config.getWindowWidth();
     windowHeight = config.getWindowHeight();
     windowTitle = config.getWindowTitle();
 
-    if (!initWindow()) {
-        Logger::error("Failed to initialize window");
-        return false;
-    }
+    // Workers for re-sorting large tables
+    sortPool = std::make_unique<ThreadPool>();
 
-    if (!initImGui()) {
-        Logger::error("Failed to initialize ImGui");
-        return false;
-    }
+    profiler = std::make_unique<Profiler>();
+    showProfiler = config.isMetricsWindowEnabled();
 
-    if (!initDatabase()) {
-        Logger::error("Failed to initialize database");
-        return false;
+    // The database side needs no window: connect and warm up on a worker
+    // while GLFW and ImGui come up on this thread (they must stay on it)
+    std::future<bool> backend = std::async(std::launch::async, [this] {
+        if (!initDatabase()) {
+            Logger::error("Failed to initialize database");
+            return false;
+        }
+        if (!initRepositories()) {
+            Logger::error("Failed to initialize repositories");
+            return false;
+        }
+        return true;
+    });
+
+    bool frontendReady = false;
+    {
+        StartupTimeline::Phase phase(startupTimeline, "window");
+        frontendReady = initWindow();
+    }
+    if (!frontendReady) {
+        Logger::error("Failed to initialize window");
+    } else {
+        StartupTimeline::Phase phase(startupTimeline, "ImGui");
+        if (!(frontendReady = initImGui())) {
+            Logger::error("Failed to initialize ImGui");
+        }
     }
+    windowReady = frontendReady;
 
-    if (!initRepositories()) {
-        Logger::error("Failed to initialize repositories");
+    // Always wait: the worker fills in members used from here on
+    bool backendReady = backend.get();
+    startupTimeline.log();
+    if (!frontendReady || !backendReady) {
         return false;
     }
 
@@ -50,6 +200,37 @@ bool Application::initialize() {
     return true;
 }
 
+void Application::initLogging() {
+    std::string level = config.getLogLevel();
+    if (level == "DEBUG") {
+        Logger::setLevel(LogLevel::DEBUG);
+    } else if (level == "WARNING") {
+        Logger::setLevel(LogLevel::WARNING);
+    } else if (level == "ERROR") {
+        Logger::setLevel(LogLevel::ERROR);
+    } else {
+        Logger::setLevel(LogLevel::INFO);
+    }
+
+    if (config.isAsyncLoggingEnabled()) {
+        AsyncLogOptions options;
+        options.queueCapacity = static_cast<size_t>(std::max(16, config.getLogQueueSize()));
+        options.flushInterval = std::chrono::milliseconds(std::max(10, config.getLogFlushIntervalMs()));
+        options.overflowPolicy = config.getLogOverflowPolicy() == "drop"
+            ? LogOverflowPolicy::Drop : LogOverflowPolicy::Block;
+        Logger::enableAsync(options);
+    }
+
+    if (config.isLogRotationEnabled()) {
+        LogRotationOptions rotation;
+        rotation.maxBytes = static_cast<uint64_t>(std::max(0, config.getMaxLogSizeMb())) * 1024 * 1024;
+        rotation.daily = config.isDailyLogRotationEnabled();
+        rotation.maxFiles = config.getMaxLogFiles();
+        rotation.compress = config.isLogCompressionEnabled();
+        Logger::setRotation(rotation);
+    }
+}
+
 bool Application::initWindow() {
     if (!glfwInit()) {
         Logger::error("Failed to initialize GLFW");
@@ -72,15 +253,38 @@ bool Application::initWindow() {
     }
 
     glfwMakeContextCurrent(window);
-    glfwSwapInterval(1); // Enable vsync
+    glfwSwapInterval(config.isVSyncEnabled() ? 1 : 0);
+
+    framePacer = std::make_unique<FramePacer>(config.getTargetFps(), config.isIdleWaitEnabled(),
+                                              std::chrono::milliseconds(config.getIdleWakeupMs()));
+    installWakeCallbacks();
 
     Logger::info("Window created: ", windowWidth, "x", windowHeight);
     return true;
 }
 
+void Application::installWakeCallbacks() {
+    // Any input or window change makes the loop draw again. ImGui's GLFW
+    // backend chains to callbacks installed before it, so these come first.
+    glfwSetWindowUserPointer(window, this);
+    static auto wake = [](GLFWwindow* source) {
+        static_cast<Application*>(glfwGetWindowUserPointer(source))->framePacer->markActive();
+    };
+    glfwSetCursorPosCallback(window, [](GLFWwindow* source, double, double) { wake(source); });
+    glfwSetCursorEnterCallback(window, [](GLFWwindow* source, int) { wake(source); });
+    glfwSetMouseButtonCallback(window, [](GLFWwindow* source, int, int, int) { wake(source); });
+    glfwSetScrollCallback(window, [](GLFWwindow* source, double, double) { wake(source); });
+    glfwSetKeyCallback(window, [](GLFWwindow* source, int, int, int, int) { wake(source); });
+    glfwSetCharCallback(window, [](GLFWwindow* source, unsigned int) { wake(source); });
+    glfwSetWindowFocusCallback(window, [](GLFWwindow* source, int) { wake(source); });
+    glfwSetWindowSizeCallback(window, [](GLFWwindow* source, int, int) { wake(source); });
+    glfwSetWindowRefreshCallback(window, [](GLFWwindow* source) { wake(source); });
+}
+
 bool Application::initImGui() {
     IMGUI_CHECKVERSION();
     ImGui::CreateContext();
+    ImPlot::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
 
@@ -114,15 +318,26 @@ bool Application::initImGui() {
 }
 
 bool Application::initDatabase() {
+    StartupTimeline::Phase phase(startupTimeline, "database connect");
     try {
         std::string connStr = config.buildConnectionString();
-        dbManager = std::make_unique<DatabaseManager>(connStr);
+        dbManager = std::make_unique<DatabaseManager>(
+            connStr,
+            static_cast<size_t>(std::max(1, config.getMaxConnections())),
+            std::chrono::seconds(config.getConnectionTimeout()));
+        dbManager->setProfiler(profiler.get());
 
         if (!dbManager->connect()) {
             Logger::error("Failed to connect to database");
             return false;
         }
 
+        ReconnectOptions reconnect;
+        reconnect.healthCheckInterval = std::chrono::milliseconds(std::max(100, config.getHealthCheckIntervalMs()));
+        reconnect.maxBackoff = std::chrono::milliseconds(std::max(250, config.getReconnectMaxBackoffMs()));
+        reconnect.readRetries = std::max(0, config.getReadRetries());
+        dbManager->startHealthChecks(reconnect);
+
         Logger::info("Database connected successfully");
         return true;
     } catch (const std::exception& e) {
@@ -133,9 +348,42 @@ bool Application::initDatabase() {
 
 bool Application::initRepositories() {
     try {
-        roomRepo = std::make_unique<RoomRepository>(*dbManager);
-        guestRepo = std::make_unique<GuestRepository>(*dbManager);
-        bookingRepo = std::make_unique<BookingRepository>(*dbManager);
+        roomRepo = std::make_unique<RoomRepository>(*dbManager, megabytes(config.getRoomCacheMb()),
+                                                    megabytes(config.getRoomTypeCacheMb()));
+        guestRepo = std::make_unique<GuestRepository>(*dbManager, megabytes(config.getGuestCacheMb()));
+        bookingRepo = std::make_unique<BookingRepository>(*dbManager, megabytes(config.getBookingCacheMb()));
+        dashboardRepo = std::make_unique<DashboardRepository>(*dbManager);
+
+        // Each loader holds its own pooled connection
+        std::future<void> guestIndex = std::async(std::launch::async, [this] {
+            StartupTimeline::Phase phase(startupTimeline, "guest search index");
+            initGuestSearchIndex();
+        });
+        warmUp();
+
+        // Started once the availability index is attached: the repositories
+        // read that pointer unsynchronized. The first snapshot then loads
+        // while the guest index and the window are still coming up.
+        dataService = std::make_unique<DataService>(
+            *dbManager, *roomRepo, *guestRepo, *bookingRepo, *dashboardRepo,
+            std::chrono::milliseconds(std::max(100, config.getDataRefreshIntervalMs())));
+        // New data wakes an idle main loop (safe from any thread once GLFW is up)
+        dataService->setPublishListener([this] {
+            if (windowReady) {
+                glfwPostEmptyEvent();
+            }
+        });
+        dataService->setRefreshHook([this] { maintainAvailabilityIndex(); });
+
+        // Keep the repository caches and the views coherent with other
+        // instances. Started ahead of the first snapshot, which is only
+        // reloaded table by table as notifications arrive.
+        {
+            StartupTimeline::Phase phase(startupTimeline, "NOTIFY listener");
+            dbManager->startListener();
+        }
+        dataService->start();
+        guestIndex.get();
 
         Logger::info("Repositories initialized");
         return true;
@@ -145,6 +393,116 @@ bool Application::initRepositories() {
     }
 }
 
+void Application::warmUp() {
+    CivilDate today = DateUtils::getToday();
+
+    // Independent reads, issued together instead of one after another
+    auto timed = [this](const char* name, auto load) {
+        return std::async(std::launch::async, [this, name, load] {
+            StartupTimeline::Phase phase(startupTimeline, name);
+            return load();
+        });
+    };
+    auto roomTypes = timed("load room types", [this] { return roomRepo->loadAllRoomTypes(); });
+    auto rooms = timed("load rooms", [this] { return roomRepo->loadAll(); });
+    auto active = timed("load active bookings", [this, today] { return bookingRepo->loadActiveFrom(today); });
+
+    std::vector<RoomType> loadedTypes;
+    std::vector<Room> loadedRooms;
+    std::vector<Booking> loadedActive;
+    try {
+        loadedTypes = roomTypes.get();
+        loadedRooms = rooms.get();
+        loadedActive = active.get();
+    } catch (const std::exception& e) {
+        // An empty index would report every room free: attach it unloaded
+        // and let the first refresh build it
+        Logger::warning("Application::warmUp failed: ", e.what());
+        availabilityIndex = std::make_unique<AvailabilityIndex>(config.getAvailabilityHorizonDays());
+        roomRepo->setAvailabilityIndex(availabilityIndex.get());
+        bookingRepo->setAvailabilityIndex(availabilityIndex.get());
+        return;
+    }
+
+    {
+        // The first dialogs open on rooms, types and today's arrivals
+        StartupTimeline::Phase phase(startupTimeline, "prime caches");
+        roomRepo->primeCaches(loadedRooms, loadedTypes);
+        std::vector<Booking> arrivals;
+        for (const Booking& booking : loadedActive) {
+            if (booking.checkInDate == today) {
+                arrivals.push_back(booking);
+            }
+        }
+        bookingRepo->primeCache(arrivals);
+    }
+
+    StartupTimeline::Phase phase(startupTimeline, "availability index");
+    initAvailabilityIndex(today, loadedTypes, loadedRooms, loadedActive);
+}
+
+void Application::initAvailabilityIndex(CivilDate today, const std::vector<RoomType>& roomTypes,
+                                        const std::vector<Room>& rooms, const std::vector<Booking>& activeBookings) {
+    availabilityIndex = std::make_unique<AvailabilityIndex>(config.getAvailabilityHorizonDays());
+
+    if (!availabilityIndex->rebuild(today, roomTypes, rooms, activeBookings)) {
+        // Repositories keep answering availability from the database
+        Logger::warning("Availability index unavailable, using database queries");
+        availabilityIndex.reset();
+        return;
+    }
+
+    roomRepo->setAvailabilityIndex(availabilityIndex.get());
+    bookingRepo->setAvailabilityIndex(availabilityIndex.get());
+}
+
+// Runs on the DataService worker. Moves the window along with the calendar
+// and reloads the index after a notification invalidated it (TRUNCATE, a
+// large import, a failed row refresh or a listener reconnect).
+void Application::maintainAvailabilityIndex() {
+    if (!availabilityIndex) {
+        return;
+    }
+
+    CivilDate today = DateUtils::getToday();
+    if (availabilityIndex->isLoaded()) {
+        availabilityIndex->advanceTo(today);
+        return;
+    }
+
+    try {
+        availabilityIndex->beginRebuild();
+        // Throwing loads: an empty result must never pass for a failed one
+        std::vector<RoomType> roomTypes = roomRepo->loadAllRoomTypes();
+        std::vector<Room> rooms = roomRepo->loadAll();
+        std::vector<Booking> active = bookingRepo->loadActiveFrom(today);
+        availabilityIndex->rebuild(today, roomTypes, rooms, active);
+    } catch (const std::exception& e) {
+        Logger::error("Application::maintainAvailabilityIndex failed: ", e.what());
+        availabilityIndex->invalidate();
+    }
+}
+
+void Application::initGuestSearchIndex() {
+    if (!config.isGuestSearchIndexEnabled()) {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    guestSearchIndex = std::make_unique<GuestSearchIndex>();
+    guestRepo->setSearchIndex(guestSearchIndex.get());
+    if (!guestRepo->rebuildSearchIndex()) {
+        // Searches keep going to the database
+        Logger::warning("Guest search index unavailable, using database queries");
+        guestRepo->setSearchIndex(nullptr);
+        guestSearchIndex.reset();
+        return;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    Logger::info("Guest search index loaded: ", guestSearchIndex->size(), " guests in ", elapsed.count(), " ms");
+}
+
 void Application::run() {
     Logger::info("Starting main loop...");
 
@@ -154,34 +512,75 @@ void Application::run() {
         render();
     }
 
-    Logger::info("Main loop ended");
+    Logger::info("Main loop ended after ", framePacer->stats().totalFrames, " frames");
 }
 
 void Application::processEvents() {
-    glfwPollEvents();
+    if (framePacer->isIdle()) {
+        // Nothing to redraw: block until input, new data or the wakeup
+        framePacer->beginWait();
+        glfwWaitEventsTimeout(framePacer->idleTimeoutSeconds());
+        framePacer->endWait();
+    } else {
+        framePacer->waitForFrameSlot();
+        ScopedPhase phase(profiler.get(), FramePhase::Events);
+        glfwPollEvents();
+    }
 }
 
 void Application::update() {
-    // Update logic here
+    ScopedPhase phase(profiler.get(), FramePhase::Update);
+
+    // A new snapshot changes what the views show
+    uint64_t version = dataService->getSnapshot()->version;
+    if (version != drawnVersion) {
+        drawnVersion = version;
+        framePacer->markActive();
+    }
+
+    // So is the connection going down or coming back
+    ConnectionState state = dbManager->getConnectionState();
+    if (state != drawnConnectionState) {
+        drawnConnectionState = state;
+        framePacer->markActive();
+    }
 }
 
 void Application::render() {
-    // Start ImGui frame
-    ImGui_ImplOpenGL3_NewFrame();
-    ImGui_ImplGlfw_NewFrame();
-    ImGui::NewFrame();
-
-    // Render UI
-    renderUI();
-
-    // Rendering
-    ImGui::Render();
-    int display_w, display_h;
-    glfwGetFramebufferSize(window, &display_w, &display_h);
-    glViewport(0, 0, display_w, display_h);
-    glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT);
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    framePacer->beginFrame();
+
+    {
+        ScopedPhase phase(profiler.get(), FramePhase::BuildUi);
+
+        // Start ImGui frame
+        ImGui_ImplOpenGL3_NewFrame();
+        ImGui_ImplGlfw_NewFrame();
+        ImGui::NewFrame();
+
+        // Render UI
+        renderUI();
+    }
+
+    {
+        ScopedPhase phase(profiler.get(), FramePhase::Submit);
+
+        // Rendering
+        ImGui::Render();
+        int display_w, display_h;
+        glfwGetFramebufferSize(window, &display_w, &display_h);
+        glViewport(0, 0, display_w, display_h);
+        glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    }
+
+    // Frame time excludes the vsync wait in the swap
+    framePacer->endFrame();
+    profiler->endFrame();
+    // Text cursors blink and drags follow the mouse while a widget is in use
+    if (ImGui::IsAnyItemActive()) {
+        framePacer->markActive();
+    }
 
     glfwSwapBuffers(window);
 }
@@ -201,6 +600,13 @@ void Application::renderUI() {
     renderMainContent();
 
     ImGui::End();
+
+    if (showFrameStats) {
+        renderFrameStats();
+    }
+    if (showProfiler) {
+        renderProfiler();
+    }
 }
 
 void Application::renderMenuBar() {
@@ -216,8 +622,17 @@ void Application::renderMenuBar() {
             if (ImGui::MenuItem("Rooms")) currentView = 1;
             if (ImGui::MenuItem("Guests")) currentView = 2;
             if (ImGui::MenuItem("Bookings")) currentView = 3;
+            ImGui::Separator();
+            ImGui::MenuItem("Frame Statistics", nullptr, &showFrameStats);
+            ImGui::MenuItem("Profiler", nullptr, &showProfiler);
             ImGui::EndMenu();
         }
+        if (drawnConnectionState == ConnectionState::Reconnecting) {
+            // Views keep showing the last snapshot meanwhile
+            const char* notice = "Database connection lost, reconnecting...";
+            ImGui::SameLine(ImGui::GetWindowWidth() - ImGui::CalcTextSize(notice).x - 16.0f);
+            ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "%s", notice);
+        }
         ImGui::EndMainMenuBar();
     }
 }
@@ -239,63 +654,190 @@ void Application::renderSidebar() {
 void Application::renderMainContent() {
     ImGui::BeginChild("MainContent", ImVec2(0, -1), true);
 
+    // Views only read the latest snapshot; the database is never touched here
+    std::shared_ptr<const DataSnapshot> data = dataService->getSnapshot();
+
+    if (data->version == 0) {
+        ImGui::Text("Loading data...");
+        ImGui::EndChild();
+        return;
+    }
+
     switch (currentView) {
-        case 0: renderDashboard(); break;
-        case 1: renderRoomsView(); break;
-        case 2: renderGuestsView(); break;
-        case 3: renderBookingsView(); break;
+        case 0: renderDashboard(*data); break;
+        case 1: renderRoomsView(*data); break;
+        case 2: renderGuestsView(*data); break;
+        case 3: renderBookingsView(*data); break;
     }
 
     ImGui::EndChild();
 }
 
-void Application::renderDashboard() {
+void Application::renderFrameStats() {
+    const FramePacer::Stats& stats = framePacer->stats();
+
+    ImGui::SetNextWindowPos(ImVec2(windowWidth - 10.0f, windowHeight - 10.0f), ImGuiCond_Always, ImVec2(1.0f, 1.0f));
+    ImGui::SetNextWindowBgAlpha(0.6f);
+    ImGui::Begin("Frame Statistics", &showFrameStats,
+        ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize |
+        ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav);
+    ImGui::Text("%.1f frames/s", stats.fps);
+    ImGui::Text("Frame: %.2f ms avg, %.2f ms max", stats.frameMs, stats.maxFrameMs);
+    ImGui::Text("CPU: %.1f%%  Idle: %.0f%%", stats.cpuPercent, stats.idlePercent);
+    ImGui::Text("Frames drawn: %llu", static_cast<unsigned long long>(stats.totalFrames));
+    ImGui::End();
+}
+
+void Application::renderProfiler() {
+    ImGui::SetNextWindowSize(ImVec2(720, 640), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Profiler", &showProfiler)) {
+        ImGui::End();
+        return;
+    }
+
+    const Profiler::FrameRing& frames = profiler->frameHistory();
+    if (frames.size() > 0) {
+        ImGui::Text("Last frame: %.2f ms (Events %.2f, Update %.2f, Build UI %.2f, GL submit %.2f)",
+                    frames.latest(),
+                    profiler->phaseHistory(FramePhase::Events).latest(),
+                    profiler->phaseHistory(FramePhase::Update).latest(),
+                    profiler->phaseHistory(FramePhase::BuildUi).latest(),
+                    profiler->phaseHistory(FramePhase::Submit).latest());
+    }
+
+    // Rings are plotted in place: offset points at the oldest sample
+    if (ImPlot::BeginPlot("Frame phases", ImVec2(-1, 200))) {
+        ImPlot::SetupAxes("frame", "ms", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        for (size_t i = 0; i < FRAME_PHASE_COUNT; i++) {
+            auto phase = static_cast<FramePhase>(i);
+            const Profiler::FrameRing& ring = profiler->phaseHistory(phase);
+            ImPlot::PlotLine(Profiler::phaseName(phase), ring.data(), static_cast<int>(ring.size()),
+                             1.0, 0.0, 0, static_cast<int>(ring.start()));
+        }
+        ImPlot::PlotLine("Total", frames.data(), static_cast<int>(frames.size()),
+                         1.0, 0.0, 0, static_cast<int>(frames.start()));
+        ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot("Frame time distribution", ImVec2(-1, 150))) {
+        ImPlot::SetupAxes("ms", "frames", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::PlotHistogram("Total", frames.data(), static_cast<int>(frames.size()), ImPlotBin_Sqrt);
+        ImPlot::EndPlot();
+    }
+
+    // Repository calls, slowest mean first
+    std::vector<Profiler::QuerySeries> queries = profiler->querySeries();
+    std::sort(queries.begin(), queries.end(), [](const auto& a, const auto& b) {
+        return a.totalMs / std::max<uint64_t>(a.calls, 1) > b.totalMs / std::max<uint64_t>(b.calls, 1);
+    });
+
+    const Profiler::QuerySeries* selected = nullptr;
+    if (ImGui::BeginTable("Queries", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY,
+                          ImVec2(0, 180))) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Repository call");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableSetupColumn("Mean ms");
+        ImGui::TableSetupColumn("Recent p95 ms");
+        ImGui::TableSetupColumn("Max ms");
+        ImGui::TableHeadersRow();
+
+        std::vector<float> recent;
+        for (const auto& series : queries) {
+            recent.assign(series.latencyMs.data(), series.latencyMs.data() + series.latencyMs.size());
+            size_t p95 = recent.size() * 95 / 100;
+            std::nth_element(recent.begin(), recent.begin() + p95, recent.end());
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            bool isSelected = series.name == selectedQuery;
+            if (ImGui::Selectable(series.name.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns)) {
+                selectedQuery = series.name;
+            }
+            if (isSelected) {
+                selected = &series;
+            }
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(series.calls));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", series.totalMs / std::max<uint64_t>(series.calls, 1));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", recent[p95]);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", series.maxMs);
+        }
+        ImGui::EndTable();
+    }
+
+    if (selected && ImPlot::BeginPlot("Call latency distribution", ImVec2(-1, 150))) {
+        ImPlot::SetupAxes("ms", "calls", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::PlotHistogram(selected->name.c_str(), selected->latencyMs.data(),
+                              static_cast<int>(selected->latencyMs.size()), ImPlotBin_Sqrt);
+        ImPlot::EndPlot();
+    }
+
+    ImGui::End();
+}
+
+void Application::renderDashboard(const DataSnapshot& data) {
     ImGui::Text("Dashboard");
     ImGui::Separator();
 
-    // Get statistics
-    int totalRooms = roomRepo->getTotalRooms();
-    int occupiedRooms = roomRepo->getRoomsByStatus(RoomStatus::Occupied);
-    int availableRooms = roomRepo->getRoomsByStatus(RoomStatus::Available);
-    int totalGuests = guestRepo->getTotalGuests();
-    int activeBookings = bookingRepo->getActiveBookingsCount();
+    const DashboardStats& stats = data.stats;
 
     // Display metrics
-    ImGui::Text("Total Rooms: %d", totalRooms);
-    ImGui::Text("Occupied: %d", occupiedRooms);
-    ImGui::Text("Available: %d", availableRooms);
+    ImGui::Text("Total Rooms: %d", stats.totalRooms);
+    ImGui::Text("Occupied: %d", stats.occupiedRooms);
+    ImGui::Text("Available: %d", stats.availableRooms);
+    ImGui::Separator();
+    ImGui::Text("Total Guests: %d", stats.totalGuests);
+    ImGui::Text("Active Bookings: %d", stats.activeBookings);
+    ImGui::Text("Arrivals Today: %d", stats.todayCheckIns);
+    ImGui::Text("Departures Today: %d", stats.todayCheckOuts);
     ImGui::Separator();
-    ImGui::Text("Total Guests: %d", totalGuests);
-    ImGui::Text("Active Bookings: %d", activeBookings);
+    ImGui::TextDisabled("Data refreshed in %.1f ms", data.loadTimeMs);
 }
 
-void Application::renderRoomsView() {
+void Application::renderRoomsView(const DataSnapshot& data) {
     ImGui::Text("Rooms Management");
     ImGui::Separator();
 
-    auto rooms = roomRepo->findAll();
+    renderStatusFilter("RoomStatus", roomView, ROOM_STATUS_OPTIONS, static_cast<int>(std::size(ROOM_STATUS_OPTIONS)));
+    ImGui::SameLine();
+    renderFilterInput("RoomFilter", "Room number", roomView, [this](std::string_view prefix) {
+        std::optional<std::vector<Completion>> completions;
+        if (availabilityIndex) {
+            completions = availabilityIndex->completeRoomNumber(prefix, AUTOCOMPLETE_LIMIT);
+        }
+        return completions.value_or(std::vector<Completion>{});
+    });
 
-    if (ImGui::BeginTable("RoomsTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+    if (ImGui::BeginTable("RoomsTable", 5, LIST_TABLE_FLAGS, ImGui::GetContentRegionAvail())) {
+        ImGui::TableSetupScrollFreeze(0, 1);
         ImGui::TableSetupColumn("Room #");
         ImGui::TableSetupColumn("Floor");
         ImGui::TableSetupColumn("Type ID");
         ImGui::TableSetupColumn("Status");
-        ImGui::TableSetupColumn("Actions");
+        ImGui::TableSetupColumn("Actions", ImGuiTableColumnFlags_NoSort);
         ImGui::TableHeadersRow();
 
-        for (const auto& room : rooms) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", room.roomNumber.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", room.floorNumber);
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", room.roomTypeId);
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", room.statusToString().c_str());
-            ImGui::TableNextColumn();
-            if (ImGui::SmallButton("View")) {
-                // View room details
+        readSortSpecs(roomView);
+        updateRows(roomView, data.rooms, roomMatches, roomSortValue);
+
+        // Only the rows in view are laid out
+        const ListRows<Room>& shown = roomView.shown;
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(shown.rows.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                size_t row = shown.rows[i];
+                ImGui::TableNextRow();
+                drawCells(shown.table->rows, row);
+                ImGui::TableNextColumn();
+                ImGui::PushID(shown.table->entities[row].id);
+                if (ImGui::SmallButton("View")) {
+                    // View room details
+                }
+                ImGui::PopID();
             }
         }
 
@@ -303,13 +845,22 @@ void Application::renderRoomsView() {
     }
 }
 
-void Application::renderGuestsView() {
+void Application::renderGuestsView(const DataSnapshot& data) {
     ImGui::Text("Guests Management");
     ImGui::Separator();
 
-    auto guests = guestRepo->findAll();
+    renderStatusFilter("GuestStatus", guestView, GUEST_STATUS_OPTIONS, static_cast<int>(std::size(GUEST_STATUS_OPTIONS)));
+    ImGui::SameLine();
+    renderFilterInput("GuestFilter", "First or last name", guestView, [this](std::string_view prefix) {
+        std::optional<std::vector<Completion>> completions;
+        if (guestSearchIndex) {
+            completions = guestSearchIndex->completeName(prefix, AUTOCOMPLETE_LIMIT);
+        }
+        return completions.value_or(std::vector<Completion>{});
+    });
 
-    if (ImGui::BeginTable("GuestsTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+    if (ImGui::BeginTable("GuestsTable", 5, LIST_TABLE_FLAGS, ImGui::GetContentRegionAvail())) {
+        ImGui::TableSetupScrollFreeze(0, 1);
         ImGui::TableSetupColumn("ID");
         ImGui::TableSetupColumn("Name");
         ImGui::TableSetupColumn("Email");
@@ -317,31 +868,36 @@ void Application::renderGuestsView() {
         ImGui::TableSetupColumn("VIP");
         ImGui::TableHeadersRow();
 
-        for (const auto& guest : guests) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", guest.id);
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", guest.getFullName().c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", guest.email.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", guest.phone.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", guest.vipStatus ? "Yes" : "No");
+        readSortSpecs(guestView);
+        updateRows(guestView, data.guests, guestMatches, guestSortValue);
+
+        const ListRows<Guest>& shown = guestView.shown;
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(shown.rows.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                ImGui::TableNextRow();
+                drawCells(shown.table->rows, shown.rows[i]);
+            }
         }
 
         ImGui::EndTable();
     }
 }
 
-void Application::renderBookingsView() {
+void Application::renderBookingsView(const DataSnapshot& data) {
     ImGui::Text("Bookings Management");
     ImGui::Separator();
 
-    auto bookings = bookingRepo->findAll();
+    renderStatusFilter("BookingStatus", bookingView, BOOKING_STATUS_OPTIONS,
+                       static_cast<int>(std::size(BOOKING_STATUS_OPTIONS)));
+    ImGui::SameLine();
+    renderFilterInput("BookingFilter", "Booking, guest or room ID", bookingView, [](std::string_view) {
+        return std::vector<Completion>{};
+    });
 
-    if (ImGui::BeginTable("BookingsTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+    if (ImGui::BeginTable("BookingsTable", 6, LIST_TABLE_FLAGS, ImGui::GetContentRegionAvail())) {
+        ImGui::TableSetupScrollFreeze(0, 1);
         ImGui::TableSetupColumn("ID");
         ImGui::TableSetupColumn("Guest ID");
         ImGui::TableSetupColumn("Room ID");
@@ -350,34 +906,207 @@ void Application::renderBookingsView() {
         ImGui::TableSetupColumn("Status");
         ImGui::TableHeadersRow();
 
-        for (const auto& booking : bookings) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", booking.id);
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", booking.guestId);
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", booking.roomId);
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", booking.checkInDate.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", booking.checkOutDate.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", booking.statusToString().c_str());
+        readSortSpecs(bookingView);
+        updateRows(bookingView, data.bookings, bookingMatches, bookingSortValue);
+
+        const ListRows<Booking>& shown = bookingView.shown;
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(shown.rows.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                ImGui::TableNextRow();
+                drawCells(shown.table->rows, shown.rows[i]);
+            }
         }
 
         ImGui::EndTable();
     }
 }
 
+void Application::renderFilterInput(const char* id, const char* hint, ListControls& view,
+                                    const std::function<std::vector<Completion>(std::string_view)>& complete) {
+    ImGui::PushID(id);
+    ImGui::SetNextItemWidth(FILTER_WIDTH);
+    if (ImGui::InputTextWithHint("##filter", hint, view.text, sizeof(view.text))) {
+        // One in-memory lookup per keystroke
+        view.suggestions = complete(view.text);
+    }
+
+    // Keep the list up while the mouse is on it: clicking a suggestion
+    // takes focus from the input first
+    bool editing = ImGui::IsItemActive();
+    if ((editing || view.suggestionsHovered) && !view.suggestions.empty()) {
+        float height = ImGui::GetTextLineHeightWithSpacing() * static_cast<float>(view.suggestions.size()) +
+                       ImGui::GetStyle().WindowPadding.y * 2.0f;
+        ImGui::BeginChild("Suggestions", ImVec2(FILTER_WIDTH, height), true);
+        for (const auto& suggestion : view.suggestions) {
+            std::string label = suggestion.weight > 1
+                ? suggestion.text + " (" + std::to_string(suggestion.weight) + ")"
+                : suggestion.text;
+            if (ImGui::Selectable(label.c_str())) {
+                std::snprintf(view.text, sizeof(view.text), "%s", suggestion.text.c_str());
+                view.suggestions.clear();
+                break;
+            }
+        }
+        view.suggestionsHovered = ImGui::IsWindowHovered();
+        ImGui::EndChild();
+    } else {
+        view.suggestionsHovered = false;
+    }
+    ImGui::PopID();
+}
+
+void Application::renderStatusFilter(const char* id, ListControls& view, const char* const options[],
+                                     int optionCount) {
+    ImGui::PushID(id);
+    ImGui::SetNextItemWidth(STATUS_FILTER_WIDTH);
+    ImGui::Combo("##status", &view.status, options, optionCount);
+    ImGui::PopID();
+}
+
+void Application::readSortSpecs(ListControls& view) {
+    ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs();
+    if (!specs || !specs->SpecsDirty) {
+        return;
+    }
+
+    view.sortKeys.assign(static_cast<size_t>(specs->SpecsCount), SortKey{});
+    for (int i = 0; i < specs->SpecsCount; i++) {
+        const ImGuiTableColumnSortSpecs& spec = specs->Specs[i];
+        view.sortKeys[static_cast<size_t>(spec.SortOrder)] = {spec.ColumnIndex,
+                                                             spec.SortDirection == ImGuiSortDirection_Descending};
+    }
+    specs->SpecsDirty = false;
+}
+
+template <typename T>
+void Application::updateRows(ListView<T>& view, const std::shared_ptr<const TableData<T>>& table,
+                             RowFilter<T> matches, RowSortValue<T> valueOf) {
+    if (view.pending.valid()) {
+        if (view.pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
+        view.shown = view.pending.get();
+        framePacer->markActive();
+    }
+
+    ListRows<T>& shown = view.shown;
+    bool sameTable = shown.table && shown.table->generation == table->generation;
+    bool refilter = !sameTable || shown.text != view.text || shown.status != view.status;
+    if (!refilter && shown.sortKeys == view.sortKeys) {
+        return;
+    }
+
+    ListRows<T> job;
+    job.table = table;
+    job.text = view.text;
+    job.status = view.status;
+    job.sortKeys = view.sortKeys;
+    if (!refilter) {
+        job.rows = shown.rows; // still drawn meanwhile
+    }
+    if (sameTable) {
+        // Ranks hold until the table changes, so sorting on other columns
+        // of the same data only ranks the columns not seen before
+        job.columnRanks = std::move(shown.columnRanks);
+    }
+
+    view.pending = std::async(std::launch::async, [this, job = std::move(job), refilter, matches, valueOf]() mutable {
+        ListRows<T> result = computeRows(*sortPool, std::move(job), refilter, matches, valueOf);
+        if (windowReady) {
+            glfwPostEmptyEvent(); // an idle loop picks the rows up
+        }
+        return result;
+    });
+}
+
+template <typename T>
+Application::ListRows<T> Application::computeRows(ThreadPool& pool, ListRows<T> job, bool refilter,
+                                                  RowFilter<T> matches, RowSortValue<T> valueOf) {
+    const TableData<T>& table = *job.table;
+    size_t rowCount = table.entities.size();
+
+    try {
+        if (refilter) {
+            bool unfiltered = job.text.empty() && job.status == 0;
+            job.rows.clear();
+            job.rows.reserve(rowCount);
+            for (size_t i = 0; i < rowCount; i++) {
+                if (unfiltered || matches(table, i, job.text, job.status)) {
+                    job.rows.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            if (job.sortKeys.empty()) {
+                return job;
+            }
+        }
+
+        if (job.sortKeys.empty()) {
+            // Back to table order
+            std::sort(job.rows.begin(), job.rows.end());
+            return job;
+        }
+
+        for (const SortKey& key : job.sortKeys) {
+            size_t column = static_cast<size_t>(key.column);
+            if (job.columnRanks.size() <= column) {
+                job.columnRanks.resize(column + 1);
+            }
+            ColumnRanks& ranks = job.columnRanks[column];
+            if (ranks.rank.size() != rowCount) {
+                ranks = rankColumn(pool, rowCount, [&](size_t row) { return valueOf(table, key.column, row); });
+            }
+        }
+
+        std::vector<const ColumnRanks*> keyRanks;
+        for (const SortKey& key : job.sortKeys) {
+            keyRanks.push_back(&job.columnRanks[static_cast<size_t>(key.column)]);
+        }
+        sortRows(pool, job.rows, job.sortKeys, keyRanks);
+    } catch (const std::exception& e) {
+        // Shown as empty rather than retried every frame
+        Logger::error("Application::computeRows failed: ", e.what());
+        job.rows.clear();
+        job.columnRanks.clear();
+    }
+    return job;
+}
+
+void Application::finishRowUpdates() {
+    if (roomView.pending.valid()) roomView.pending.wait();
+    if (guestView.pending.valid()) guestView.pending.wait();
+    if (bookingView.pending.valid()) bookingView.pending.wait();
+}
+
 void Application::shutdown() {
+    // Stop background queries before the repositories and database go away
+    if (dataService) {
+        dataService->stop();
+    }
+    if (dbManager) {
+        dbManager->stopListener();
+        dbManager->stopHealthChecks();
+    }
+    if (roomRepo && guestRepo && bookingRepo) {
+        logCacheStats("rooms", roomRepo->getRoomCacheStats());
+        logCacheStats("room types", roomRepo->getRoomTypeCacheStats());
+        logCacheStats("guests", guestRepo->getCacheStats());
+        logCacheStats("bookings", bookingRepo->getCacheStats());
+    }
+
+    // Row jobs post GLFW events
+    finishRowUpdates();
+
     if (window) {
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
+        ImPlot::DestroyContext();
         ImGui::DestroyContext();
 
         glfwDestroyWindow(window);
         glfwTerminate();
+        window = nullptr;
 
         Logger::info("Application shut down");
     }
@@ -193,6 +193,26 @@ std::string Config::getDatabaseSSLMode() const {
     return getString("database", "sslmode", "prefer");
 }
 
+int Config::getMaxConnections() const {
+    return getInt("database", "max_connections", 10);
+}
+
+int Config::getConnectionTimeout() const {
+    return getInt("database", "connection_timeout", 30);
+}
+
+int Config::getHealthCheckIntervalMs() const {
+    return getInt("database", "health_check_interval_ms", 5000);
+}
+
+int Config::getReconnectMaxBackoffMs() const {
+    return getInt("database", "reconnect_max_backoff_ms", 30000);
+}
+
+int Config::getReadRetries() const {
+    return getInt("database", "read_retries", 2);
+}
+
 std::string Config::buildConnectionString() const {
     std::ostringstream oss;
     oss << "host=" << getDatabaseHost()
@@ -200,7 +220,8 @@ std::string Config::buildConnectionString() const {
         << " dbname=" << getDatabaseName()
         << " user=" << getDatabaseUser()
         << " password=" << getDatabasePassword()
-        << " sslmode=" << getDatabaseSSLMode();
+        << " sslmode=" << getDatabaseSSLMode()
+        << " connect_timeout=" << getConnectionTimeout();
     return oss.str();
 }
 
@@ -229,6 +250,50 @@ int Config::getMSAASamples() const {
     return getInt("application", "msaa_samples", 4);
 }
 
+int Config::getTargetFps() const {
+    return getInt("application", "target_fps", 60);
+}
+
+bool Config::isIdleWaitEnabled() const {
+    return getBool("application", "idle_wait", true);
+}
+
+int Config::getIdleWakeupMs() const {
+    return getInt("application", "idle_wakeup_ms", 500);
+}
+
+bool Config::isMetricsWindowEnabled() const {
+    return getBool("development", "show_metrics_window", false);
+}
+
+int Config::getDataRefreshIntervalMs() const {
+    return getInt("application", "data_refresh_interval_ms", 2000);
+}
+
+int Config::getAvailabilityHorizonDays() const {
+    return getInt("features", "availability_horizon_days", 730);
+}
+
+bool Config::isGuestSearchIndexEnabled() const {
+    return getBool("features", "guest_search_index", true);
+}
+
+int Config::getGuestCacheMb() const {
+    return getInt("cache", "guests_mb", 32);
+}
+
+int Config::getBookingCacheMb() const {
+    return getInt("cache", "bookings_mb", 32);
+}
+
+int Config::getRoomCacheMb() const {
+    return getInt("cache", "rooms_mb", 4);
+}
+
+int Config::getRoomTypeCacheMb() const {
+    return getInt("cache", "room_types_mb", 1);
+}
+
 // Logging settings
 std::string Config::getLogLevel() const {
     return getString("logging", "level", "INFO");
@@ -238,6 +303,42 @@ std::string Config::getLogFile() const {
     return getString("logging", "log_file", "hotel_system.log");
 }
 
+bool Config::isAsyncLoggingEnabled() const {
+    return getBool("logging", "async", true);
+}
+
+int Config::getLogQueueSize() const {
+    return getInt("logging", "queue_size", 8192);
+}
+
+int Config::getLogFlushIntervalMs() const {
+    return getInt("logging", "flush_interval_ms", 250);
+}
+
+std::string Config::getLogOverflowPolicy() const {
+    return toLower(getString("logging", "overflow_policy", "block"));
+}
+
+bool Config::isLogRotationEnabled() const {
+    return getBool("logging", "rotate_logs", true);
+}
+
+int Config::getMaxLogSizeMb() const {
+    return getInt("logging", "max_log_size_mb", 10);
+}
+
+bool Config::isDailyLogRotationEnabled() const {
+    return getBool("logging", "rotate_daily", true);
+}
+
+int Config::getMaxLogFiles() const {
+    return getInt("logging", "max_log_files", 7);
+}
+
+bool Config::isLogCompressionEnabled() const {
+    return getBool("logging", "compress_logs", true);
+}
+
 void Config::clear() {
     data.clear();
 }
@@ -0,0 +1,249 @@
+#include "core/DataService.hpp"
+#include "utils/Logger.hpp"
+#include <charconv>
+
+namespace HotelManagement {
+
+namespace {
+
+// Integer cell text without a heap allocation
+class IntText {
+public:
+    explicit IntText(int value)
+        : length(static_cast<size_t>(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer)) {}
+
+    std::string_view view() const { return {buffer, length}; }
+
+private:
+    char buffer[12];
+    size_t length;
+};
+
+void formatRows(TableData<Room>& table) {
+    table.rows.reserve(table.entities.size(), 32);
+    for (const auto& room : table.entities) {
+        table.rows.addRow({room.roomNumber, IntText(room.floorNumber).view(),
+                           IntText(room.roomTypeId).view(), room.statusToString()});
+    }
+}
+
+void formatRows(TableData<Guest>& table) {
+    table.rows.reserve(table.entities.size(), 64);
+    for (const auto& guest : table.entities) {
+        table.rows.addRow({IntText(guest.id).view(), guest.getFullName(), guest.email, guest.phone,
+                           guest.vipStatus ? "Yes" : "No"});
+    }
+}
+
+void formatRows(TableData<Booking>& table) {
+    table.rows.reserve(table.entities.size(), 48);
+    for (const auto& booking : table.entities) {
+        table.rows.addRow({IntText(booking.id).view(), IntText(booking.guestId).view(),
+                           IntText(booking.roomId).view(), booking.checkInDate.toChars().data(),
+                           booking.checkOutDate.toChars().data(), booking.statusToString()});
+    }
+}
+
+enum class Reload { Unchanged, Changed, Failed };
+
+// Replaces table with a fresh load if its rows differ. On failure the old
+// table stays.
+template <typename T, typename Load>
+Reload reloadTable(std::shared_ptr<const TableData<T>>& table, uint64_t& nextGeneration, const char* name,
+                   Load load) {
+    try {
+        auto fresh = std::make_shared<TableData<T>>(table->rows.columnCount());
+        fresh->entities = load();
+        if (fresh->entities == table->entities) {
+            return Reload::Unchanged;
+        }
+        formatRows(*fresh);
+        fresh->generation = nextGeneration++;
+        table = std::move(fresh);
+        return Reload::Changed;
+    } catch (const std::exception& e) {
+        Logger::error("DataService: loading ", name, " failed: ", e.what());
+        return Reload::Failed;
+    }
+}
+
+} // namespace
+
+DataService::DataService(DatabaseManager& db, RoomRepository& rooms, GuestRepository& guests,
+                         BookingRepository& bookings, DashboardRepository& dashboard,
+                         std::chrono::milliseconds interval)
+    : dbManager(db), roomRepo(rooms), guestRepo(guests), bookingRepo(bookings), dashboardRepo(dashboard),
+      refreshInterval(interval), current(std::make_shared<DataSnapshot>()) {
+    // An empty payload after a listener reconnect reaches every channel,
+    // so each table is reloaded then
+    const std::pair<const char*, unsigned> channels[] = {
+        {"rooms_changed", RoomsTable},       {"rooms_inserted", RoomsTable},
+        {"guests_changed", GuestsTable},     {"guests_inserted", GuestsTable},
+        {"bookings_changed", BookingsTable}, {"bookings_inserted", BookingsTable},
+    };
+    for (const auto& [channel, table] : channels) {
+        handlerIds.push_back(dbManager.addNotificationHandler(channel, [this, table = table](const std::string&) {
+            markStale(table);
+        }));
+    }
+}
+
+DataService::~DataService() {
+    stop();
+    for (int id : handlerIds) {
+        dbManager.removeNotificationHandler(id);
+    }
+}
+
+void DataService::start() {
+    std::lock_guard<std::mutex> lock(workerMutex);
+    if (worker.joinable()) {
+        return;
+    }
+
+    stopRequested = false;
+    refreshRequested = true;
+    worker = std::thread(&DataService::workerLoop, this);
+    Logger::info("DataService started (refresh every ", refreshInterval.count(), " ms)");
+}
+
+void DataService::stop() {
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        if (!worker.joinable()) {
+            return;
+        }
+        stopRequested = true;
+    }
+    wakeUp.notify_all();
+    worker.join();
+    Logger::info("DataService stopped");
+}
+
+void DataService::requestRefresh() {
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        refreshRequested = true;
+    }
+    wakeUp.notify_all();
+}
+
+// Runs on the notification listener thread (or the worker, for retries)
+void DataService::markStale(unsigned tables) {
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        staleTables |= tables;
+        refreshRequested = true;
+    }
+    wakeUp.notify_all();
+}
+
+void DataService::setPublishListener(std::function<void()> listener) {
+    publishListener = std::move(listener);
+}
+
+void DataService::setRefreshHook(std::function<void()> hook) {
+    refreshHook = std::move(hook);
+}
+
+std::shared_ptr<const DataSnapshot> DataService::getSnapshot() const {
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+    return current;
+}
+
+void DataService::workerLoop() {
+    std::unique_lock<std::mutex> lock(workerMutex);
+
+    while (!stopRequested) {
+        wakeUp.wait_for(lock, refreshInterval, [this] {
+            return stopRequested || refreshRequested;
+        });
+        if (stopRequested) {
+            break;
+        }
+        refreshRequested = false;
+
+        // Query without holding the lock so requestRefresh() never blocks
+        lock.unlock();
+        try {
+            if (refreshHook) {
+                refreshHook();
+            }
+            if (auto snapshot = loadSnapshot()) {
+                publish(std::move(snapshot));
+            }
+        } catch (const std::exception& e) {
+            Logger::error("DataService refresh failed: ", e.what());
+        }
+        lock.lock();
+    }
+}
+
+std::shared_ptr<DataSnapshot> DataService::loadSnapshot() {
+    auto start = std::chrono::steady_clock::now();
+
+    unsigned stale;
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        stale = staleTables;
+        staleTables = 0;
+    }
+
+    // Starts out sharing every table with the current snapshot
+    std::shared_ptr<const DataSnapshot> previous = getSnapshot();
+    auto snapshot = std::make_shared<DataSnapshot>(*previous);
+    snapshot->stats = dashboardRepo.fetchStats();
+
+    unsigned changed = 0;
+    unsigned failed = 0;
+    auto track = [&](Reload result, unsigned table) {
+        if (result == Reload::Changed) changed |= table;
+        if (result == Reload::Failed) failed |= table;
+    };
+    if (stale & RoomsTable) {
+        track(reloadTable(snapshot->rooms, nextGeneration, "rooms", [this] { return roomRepo.loadAll(); }),
+              RoomsTable);
+    }
+    if (stale & GuestsTable) {
+        track(reloadTable(snapshot->guests, nextGeneration, "guests", [this] { return guestRepo.loadAll(); }),
+              GuestsTable);
+    }
+    if (stale & BookingsTable) {
+        track(reloadTable(snapshot->bookings, nextGeneration, "bookings", [this] { return bookingRepo.loadAll(); }),
+              BookingsTable);
+    }
+    if (failed) {
+        // Retried on the next refresh. Not at once: the database is
+        // probably down and the health check is already on it.
+        std::lock_guard<std::mutex> lock(workerMutex);
+        staleTables |= failed;
+    }
+
+    // Nothing to show and nobody to wake (the first snapshot always goes out)
+    if (!changed && snapshot->stats == previous->stats && previous->version != 0) {
+        return nullptr;
+    }
+
+    snapshot->refreshedAt = std::chrono::system_clock::now();
+    snapshot->loadTimeMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+
+    return snapshot;
+}
+
+void DataService::publish(std::shared_ptr<DataSnapshot> snapshot) {
+    std::shared_ptr<const DataSnapshot> previous;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex);
+        snapshot->version = nextVersion++;
+        previous = std::move(current);
+        current = std::move(snapshot);
+    }
+    // previous is released here, outside the lock, unless a frame still holds it
+
+    if (publishListener) {
+        publishListener();
+    }
+}
+
+} // namespace HotelManagement
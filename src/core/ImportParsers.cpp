@@ -0,0 +1,244 @@
+#include "core/ImportParsers.hpp"
+#include "utils/Validators.hpp"
+#include "utils/DateUtils.hpp"
+#include <charconv>
+#include <memory>
+
+namespace HotelManagement {
+
+namespace {
+
+// Header positions of the columns a parser reads, resolved once
+class Columns {
+public:
+    Columns(const CsvHeader& header, std::initializer_list<const char*> names) {
+        for (const char* name : names) {
+            indexes.push_back(header.indexOf(name));
+        }
+    }
+
+    bool has(size_t column) const { return indexes[column] >= 0; }
+
+    const std::string& get(const std::vector<std::string>& fields, size_t column) const {
+        static const std::string empty;
+        int index = indexes[column];
+        return index >= 0 && static_cast<size_t>(index) < fields.size() ? fields[static_cast<size_t>(index)] : empty;
+    }
+
+private:
+    std::vector<int> indexes;
+};
+
+// Sets error to the first required column missing from the header
+bool hasRequired(const Columns& columns, std::initializer_list<std::pair<size_t, const char*>> required,
+                 std::string& error) {
+    for (const auto& [column, name] : required) {
+        if (!columns.has(column)) {
+            error = std::string("Missing required column '") + name + "'";
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool parseNumber(const std::string& text, T& value) {
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return ec == std::errc() && end == text.data() + text.size();
+}
+
+bool parseBool(const std::string& text, bool& value) {
+    if (text.empty() || text == "false" || text == "f" || text == "0" || text == "no") {
+        value = false;
+        return true;
+    }
+    if (text == "true" || text == "t" || text == "1" || text == "yes") {
+        value = true;
+        return true;
+    }
+    return false;
+}
+
+bool fail(std::string& error, const char* column, const std::string& value) {
+    error = std::string("Invalid ") + column + " '" + value + "'";
+    return false;
+}
+
+enum GuestColumn : size_t {
+    GUEST_FIRST_NAME, GUEST_LAST_NAME, GUEST_EMAIL, GUEST_PHONE, GUEST_ADDRESS, GUEST_ID_TYPE,
+    GUEST_ID_NUMBER, GUEST_DATE_OF_BIRTH, GUEST_NATIONALITY, GUEST_VIP_STATUS
+};
+
+enum RoomColumn : size_t {
+    ROOM_NUMBER, ROOM_TYPE_ID, ROOM_FLOOR_NUMBER, ROOM_STATUS, ROOM_NOTES
+};
+
+enum BookingColumn : size_t {
+    BOOKING_GUEST_ID, BOOKING_ROOM_ID, BOOKING_CHECK_IN, BOOKING_CHECK_OUT, BOOKING_NUM_ADULTS,
+    BOOKING_NUM_CHILDREN, BOOKING_STATUS, BOOKING_SPECIAL_REQUESTS, BOOKING_TOTAL_AMOUNT
+};
+
+bool parseGuest(const Columns& c, const std::vector<std::string>& f, Guest& guest, std::string& error) {
+    guest.firstName = c.get(f, GUEST_FIRST_NAME);
+    guest.lastName = c.get(f, GUEST_LAST_NAME);
+    guest.email = c.get(f, GUEST_EMAIL);
+    guest.phone = c.get(f, GUEST_PHONE);
+    guest.address = c.get(f, GUEST_ADDRESS);
+    guest.idType = c.get(f, GUEST_ID_TYPE);
+    guest.idNumber = c.get(f, GUEST_ID_NUMBER);
+    guest.dateOfBirth = c.get(f, GUEST_DATE_OF_BIRTH);
+    guest.nationality = c.get(f, GUEST_NATIONALITY);
+
+    if (!Validators::isValidName(guest.firstName)) {
+        return fail(error, "first_name", guest.firstName);
+    }
+    if (!Validators::isValidName(guest.lastName)) {
+        return fail(error, "last_name", guest.lastName);
+    }
+    if (!guest.email.empty() && !Validators::isValidEmail(guest.email)) {
+        return fail(error, "email", guest.email);
+    }
+    if (!Validators::isValidPhone(guest.phone)) {
+        return fail(error, "phone", guest.phone);
+    }
+    if (guest.idType != "passport" && guest.idType != "drivers_license" && guest.idType != "national_id") {
+        return fail(error, "id_type", guest.idType);
+    }
+    if (!Validators::isValidIDNumber(guest.idNumber)) {
+        return fail(error, "id_number", guest.idNumber);
+    }
+    if (!guest.dateOfBirth.empty() && !DateUtils::isValidDate(guest.dateOfBirth)) {
+        return fail(error, "date_of_birth", guest.dateOfBirth);
+    }
+    if (!parseBool(c.get(f, GUEST_VIP_STATUS), guest.vipStatus)) {
+        return fail(error, "vip_status", c.get(f, GUEST_VIP_STATUS));
+    }
+    return true;
+}
+
+bool parseRoom(const Columns& c, const std::vector<std::string>& f, Room& room, std::string& error) {
+    room.roomNumber = c.get(f, ROOM_NUMBER);
+    room.notes = c.get(f, ROOM_NOTES);
+
+    if (!Validators::isValidRoomNumber(room.roomNumber)) {
+        return fail(error, "room_number", room.roomNumber);
+    }
+    if (!parseNumber(c.get(f, ROOM_TYPE_ID), room.roomTypeId) || room.roomTypeId <= 0) {
+        return fail(error, "room_type_id", c.get(f, ROOM_TYPE_ID));
+    }
+    if (!parseNumber(c.get(f, ROOM_FLOOR_NUMBER), room.floorNumber) || room.floorNumber <= 0) {
+        return fail(error, "floor_number", c.get(f, ROOM_FLOOR_NUMBER));
+    }
+
+    const std::string& status = c.get(f, ROOM_STATUS);
+    if (!status.empty()) {
+        room.status = Room::stringToStatus(status);
+        if (room.statusToString() != status) {
+            return fail(error, "status", status);
+        }
+    }
+    return true;
+}
+
+bool parseBooking(const Columns& c, const std::vector<std::string>& f, Booking& booking, std::string& error) {
+    if (!parseNumber(c.get(f, BOOKING_GUEST_ID), booking.guestId) || booking.guestId <= 0) {
+        return fail(error, "guest_id", c.get(f, BOOKING_GUEST_ID));
+    }
+    if (!parseNumber(c.get(f, BOOKING_ROOM_ID), booking.roomId) || booking.roomId <= 0) {
+        return fail(error, "room_id", c.get(f, BOOKING_ROOM_ID));
+    }
+
+    booking.checkInDate = CivilDate::parse(c.get(f, BOOKING_CHECK_IN));
+    if (!booking.checkInDate.isValid()) {
+        return fail(error, "check_in_date", c.get(f, BOOKING_CHECK_IN));
+    }
+    booking.checkOutDate = CivilDate::parse(c.get(f, BOOKING_CHECK_OUT));
+    if (!booking.checkOutDate.isValid() || booking.checkOutDate <= booking.checkInDate) {
+        return fail(error, "check_out_date", c.get(f, BOOKING_CHECK_OUT));
+    }
+
+    const std::string& adults = c.get(f, BOOKING_NUM_ADULTS);
+    if (!adults.empty() && (!parseNumber(adults, booking.numAdults) || booking.numAdults <= 0)) {
+        return fail(error, "num_adults", adults);
+    }
+    const std::string& children = c.get(f, BOOKING_NUM_CHILDREN);
+    if (!children.empty() && (!parseNumber(children, booking.numChildren) || booking.numChildren < 0)) {
+        return fail(error, "num_children", children);
+    }
+
+    const std::string& status = c.get(f, BOOKING_STATUS);
+    if (!status.empty()) {
+        booking.status = Booking::stringToStatus(status);
+        if (booking.statusToString() != status) {
+            return fail(error, "status", status);
+        }
+    }
+
+    booking.specialRequests = c.get(f, BOOKING_SPECIAL_REQUESTS);
+
+    const std::string& amount = c.get(f, BOOKING_TOTAL_AMOUNT);
+    if (!amount.empty() && (!Validators::isValidCurrency(amount) || !parseNumber(amount, booking.totalAmount) ||
+                            !Validators::isValidPrice(booking.totalAmount))) {
+        return fail(error, "total_amount", amount);
+    }
+    return true;
+}
+
+} // namespace
+
+CsvImporter<Guest>::RowParser ImportParsers::guests(const CsvHeader& header, std::string& error) {
+    auto columns = std::make_shared<Columns>(header, std::initializer_list<const char*>{
+        "first_name", "last_name", "email", "phone", "address", "id_type", "id_number",
+        "date_of_birth", "nationality", "vip_status"});
+    if (!hasRequired(*columns, {{GUEST_FIRST_NAME, "first_name"}, {GUEST_LAST_NAME, "last_name"},
+                                {GUEST_PHONE, "phone"}, {GUEST_ID_TYPE, "id_type"},
+                                {GUEST_ID_NUMBER, "id_number"}}, error)) {
+        return {};
+    }
+
+    return [columns](const std::vector<std::string>& fields, std::string& rowError) -> std::optional<Guest> {
+        Guest guest;
+        if (!parseGuest(*columns, fields, guest, rowError)) {
+            return std::nullopt;
+        }
+        return guest;
+    };
+}
+
+CsvImporter<Room>::RowParser ImportParsers::rooms(const CsvHeader& header, std::string& error) {
+    auto columns = std::make_shared<Columns>(header, std::initializer_list<const char*>{
+        "room_number", "room_type_id", "floor_number", "status", "notes"});
+    if (!hasRequired(*columns, {{ROOM_NUMBER, "room_number"}, {ROOM_TYPE_ID, "room_type_id"},
+                                {ROOM_FLOOR_NUMBER, "floor_number"}}, error)) {
+        return {};
+    }
+
+    return [columns](const std::vector<std::string>& fields, std::string& rowError) -> std::optional<Room> {
+        Room room;
+        if (!parseRoom(*columns, fields, room, rowError)) {
+            return std::nullopt;
+        }
+        return room;
+    };
+}
+
+CsvImporter<Booking>::RowParser ImportParsers::bookings(const CsvHeader& header, std::string& error) {
+    auto columns = std::make_shared<Columns>(header, std::initializer_list<const char*>{
+        "guest_id", "room_id", "check_in_date", "check_out_date", "num_adults", "num_children",
+        "status", "special_requests", "total_amount"});
+    if (!hasRequired(*columns, {{BOOKING_GUEST_ID, "guest_id"}, {BOOKING_ROOM_ID, "room_id"},
+                                {BOOKING_CHECK_IN, "check_in_date"}, {BOOKING_CHECK_OUT, "check_out_date"}},
+                     error)) {
+        return {};
+    }
+
+    return [columns](const std::vector<std::string>& fields, std::string& rowError) -> std::optional<Booking> {
+        Booking booking;
+        if (!parseBooking(*columns, fields, booking, rowError)) {
+            return std::nullopt;
+        }
+        return booking;
+    };
+}
+
+} // namespace HotelManagement
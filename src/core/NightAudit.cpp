@@ -0,0 +1,119 @@
+#include "core/NightAudit.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <unordered_set>
+
+namespace HotelManagement {
+
+namespace {
+
+// Revenue of one night of a stay
+double nightlyRate(const Booking& booking) {
+    int nights = booking.getDurationDays();
+    return nights > 0 ? booking.totalAmount / nights : 0.0;
+}
+
+bool coversNight(const Booking& booking, CivilDate night) {
+    return booking.checkInDate <= night && night < booking.checkOutDate;
+}
+
+} // namespace
+
+NightAuditReport NightAudit::run(BookingRepository& bookings, RoomRepository& rooms,
+                                 CivilDate businessDate, bool cancelNoShows) {
+    NightAuditReport report;
+    report.businessDate = businessDate;
+
+    std::unordered_set<int> roomsInHouse;
+    bookings.forEach([&](const Booking& booking) {
+        switch (booking.status) {
+            case BookingStatus::Pending:
+            case BookingStatus::Confirmed:
+                // Arrivals due on the business date may still turn up
+                if (booking.checkInDate < businessDate) {
+                    report.noShows.push_back(booking);
+                }
+                break;
+            case BookingStatus::CheckedIn:
+                roomsInHouse.insert(booking.roomId);
+                if (booking.checkOutDate <= businessDate) {
+                    report.overdueDepartures.push_back(booking);
+                }
+                break;
+            case BookingStatus::CheckedOut:
+                if (booking.checkOutDate == businessDate) {
+                    report.departures++;
+                }
+                break;
+            case BookingStatus::Cancelled:
+                return true;
+        }
+
+        bool arrived = booking.status == BookingStatus::CheckedIn || booking.status == BookingStatus::CheckedOut;
+        if (arrived && booking.checkInDate == businessDate) {
+            report.arrivals++;
+        }
+        if (arrived && coversNight(booking, businessDate)) {
+            report.roomsOccupied++;
+            report.roomRevenue += nightlyRate(booking);
+        }
+        return true;
+    });
+
+    rooms.forEach([&](const Room& room) {
+        report.totalRooms++;
+        bool marked = room.status == RoomStatus::Occupied;
+        bool inHouse = roomsInHouse.count(room.id) > 0;
+        if (marked && !inHouse) {
+            report.occupiedWithoutStay.push_back(room.id);
+        } else if (inHouse && !marked) {
+            report.stayInFreeRoom.push_back(room.id);
+        }
+        return true;
+    });
+
+    // Written after the scan: the stream holds its connection until it ends
+    if (cancelNoShows) {
+        for (Booking booking : report.noShows) {
+            booking.status = BookingStatus::Cancelled;
+            if (bookings.update(booking)) {
+                report.noShowsCancelled++;
+            }
+        }
+    }
+
+    Logger::info("Night audit ", businessDate.toString(), ": ", report.roomsOccupied, "/", report.totalRooms,
+                 " rooms, ", report.noShows.size(), " no-shows (", report.noShowsCancelled, " cancelled), ",
+                 report.overdueDepartures.size(), " overdue departures");
+    return report;
+}
+
+std::vector<OccupancyDay> NightAudit::occupancy(BookingRepository& bookings, CivilDate from, CivilDate to) {
+    std::vector<OccupancyDay> days;
+    if (!from.isValid() || !to.isValid() || to <= from) {
+        return days;
+    }
+
+    days.resize(static_cast<size_t>(to - from));
+    for (size_t i = 0; i < days.size(); i++) {
+        days[i].date = from + static_cast<int>(i);
+    }
+
+    bookings.forEach([&](const Booking& booking) {
+        if (booking.status == BookingStatus::Cancelled || !booking.overlaps(from, to)) {
+            return true;
+        }
+        double rate = nightlyRate(booking);
+        CivilDate first = std::max(booking.checkInDate, from);
+        CivilDate last = std::min(booking.checkOutDate, to);
+        for (CivilDate night = first; night < last; night = night + 1) {
+            OccupancyDay& day = days[static_cast<size_t>(night - from)];
+            day.roomsSold++;
+            day.roomRevenue += rate;
+        }
+        return true;
+    });
+    return days;
+}
+
+} // namespace HotelManagement
@@ -0,0 +1,95 @@
+#include "core/RowOrder.hpp"
+#include "utils/ParallelSort.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace HotelManagement {
+
+namespace {
+
+// Sort (value, row) pairs and hand out dense ranks
+template<typename Value>
+ColumnRanks rankEntries(ThreadPool& pool, std::vector<std::pair<Value, uint32_t>>& entries) {
+    parallelSort(pool, entries, [](const auto& a, const auto& b) { return a < b; });
+
+    ColumnRanks ranks;
+    ranks.rank.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (i > 0 && entries[i - 1].first != entries[i].first) {
+            ranks.distinct++;
+        }
+        ranks.rank[entries[i].second] = ranks.distinct;
+    }
+    if (!entries.empty()) {
+        ranks.distinct++;
+    }
+    return ranks;
+}
+
+} // namespace
+
+ColumnRanks rankColumn(ThreadPool& pool, size_t rowCount, const std::function<SortValue(size_t)>& valueOf) {
+    std::vector<std::pair<SortValue, uint32_t>> entries(rowCount);
+    bool allNumbers = true;
+    for (size_t row = 0; row < rowCount; row++) {
+        entries[row] = {valueOf(row), static_cast<uint32_t>(row)};
+        allNumbers = allNumbers && std::holds_alternative<int64_t>(entries[row].first);
+    }
+    if (!allNumbers) {
+        // Mixed columns put numbers before strings
+        return rankEntries(pool, entries);
+    }
+
+    // Plain integers sort several times faster than variants
+    std::vector<std::pair<int64_t, uint32_t>> numbers(rowCount);
+    for (size_t row = 0; row < rowCount; row++) {
+        numbers[row] = {std::get<int64_t>(entries[row].first), entries[row].second};
+    }
+    entries = {};
+    return rankEntries(pool, numbers);
+}
+
+void sortRows(ThreadPool& pool, std::vector<uint32_t>& rows, const std::vector<SortKey>& keys,
+              const std::vector<const ColumnRanks*>& ranks) {
+    // Descending keys use the complement of the rank
+    auto keyRank = [&](size_t key, uint32_t row) {
+        uint32_t rank = ranks[key]->rank[row];
+        return keys[key].descending ? ranks[key]->distinct - 1 - rank : rank;
+    };
+
+    std::vector<int> widths;
+    int totalWidth = 0;
+    for (const ColumnRanks* column : ranks) {
+        int width = std::bit_width(std::max<uint32_t>(column->distinct, 1) - 1);
+        widths.push_back(width);
+        totalWidth += width;
+    }
+
+    if (totalWidth <= 32) {
+        // Sorting plain integers keeps every comparison in cache
+        std::vector<uint64_t> packed(rows.size());
+        for (size_t i = 0; i < rows.size(); i++) {
+            uint64_t composite = 0;
+            for (size_t key = 0; key < keys.size(); key++) {
+                composite = (composite << widths[key]) | keyRank(key, rows[i]);
+            }
+            packed[i] = (composite << 32) | rows[i];
+        }
+        parallelSort(pool, packed, std::less<uint64_t>());
+        for (size_t i = 0; i < rows.size(); i++) {
+            rows[i] = static_cast<uint32_t>(packed[i]);
+        }
+        return;
+    }
+
+    parallelSort(pool, rows, [&](uint32_t a, uint32_t b) {
+        for (size_t key = 0; key < keys.size(); key++) {
+            uint32_t x = keyRank(key, a);
+            uint32_t y = keyRank(key, b);
+            if (x != y) return x < y;
+        }
+        return a < b;
+    });
+}
+
+} // namespace HotelManagement
@@ -0,0 +1,112 @@
+#include "core/TableTransfer.hpp"
+#include "core/ImportParsers.hpp"
+#include "database/repositories/GuestRepository.hpp"
+#include "database/repositories/RoomRepository.hpp"
+#include "database/repositories/BookingRepository.hpp"
+#include "utils/Csv.hpp"
+#include <chrono>
+#include <fstream>
+
+namespace HotelManagement {
+
+namespace {
+
+template<typename Record, typename Repository>
+bool importFile(Repository& repo, const std::string& file, const ImportOptions& options,
+                const typename CsvImporter<Record>::ParserFactory& makeParser,
+                std::ostream& out, std::ostream& err) {
+    CsvImporter<Record> importer(options);
+    ImportResult result = importer.run(file, makeParser, [&](const std::vector<Record>& batch) {
+        return repo.createMany(batch).size() == batch.size();
+    });
+
+    for (const auto& rowError : result.errors) {
+        err << "Line " << rowError.line << ": " << rowError.message << "\n";
+    }
+    if (result.rowsRejected > result.errors.size()) {
+        err << "... " << (result.rowsRejected - result.errors.size()) << " more rejected rows\n";
+    }
+    if (!result.completed) {
+        err << "Import failed: " << result.failure << "\n";
+    }
+
+    out << "Imported " << result.rowsImported << " of " << result.rowsRead << " rows ("
+        << result.rowsRejected << " rejected) in " << result.seconds << " s, "
+        << static_cast<uint64_t>(result.getRowsPerSecond()) << " rows/sec\n";
+    return result.completed;
+}
+
+} // namespace
+
+bool TableTransfer::isTransferTable(const std::string& table) {
+    return table == "guests" || table == "rooms" || table == "bookings";
+}
+
+bool TableTransfer::importCsv(DatabaseManager& db, const std::string& table, const std::string& file,
+                              const ImportOptions& options, std::ostream& out, std::ostream& err) {
+    if (table == "guests") {
+        GuestRepository repo(db);
+        return importFile<Guest>(repo, file, options, ImportParsers::guests, out, err);
+    }
+    if (table == "rooms") {
+        RoomRepository repo(db);
+        return importFile<Room>(repo, file, options, ImportParsers::rooms, out, err);
+    }
+    if (table == "bookings") {
+        BookingRepository repo(db);
+        return importFile<Booking>(repo, file, options, ImportParsers::bookings, out, err);
+    }
+    err << "Unknown table: " << table << "\n";
+    return false;
+}
+
+bool TableTransfer::exportCsv(DatabaseManager& db, const std::string& table, const std::string& file,
+                              std::ostream& out, std::ostream& err) {
+    if (!isTransferTable(table)) {
+        err << "Unknown table: " << table << "\n";
+        return false;
+    }
+
+    std::ofstream output(file, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        err << "Cannot open " << file << "\n";
+        return false;
+    }
+
+    CsvWriter writer(output);
+    auto started = std::chrono::steady_clock::now();
+    size_t exported = 0;
+
+    if (table == "guests") {
+        GuestRepository repo(db);
+        writer.writeRow({"id", "first_name", "last_name", "email", "phone", "address", "id_type", "id_number",
+                         "date_of_birth", "nationality", "vip_status"});
+        exported = repo.exportAll([&](const Guest& g) {
+            writer.writeRow({std::to_string(g.id), g.firstName, g.lastName, g.email, g.phone, g.address,
+                             g.idType, g.idNumber, g.dateOfBirth, g.nationality, g.vipStatus ? "true" : "false"});
+        });
+    } else if (table == "rooms") {
+        RoomRepository repo(db);
+        writer.writeRow({"id", "room_number", "room_type_id", "floor_number", "status", "notes"});
+        exported = repo.exportAll([&](const Room& r) {
+            writer.writeRow({std::to_string(r.id), r.roomNumber, std::to_string(r.roomTypeId),
+                             std::to_string(r.floorNumber), r.statusToString(), r.notes});
+        });
+    } else {
+        BookingRepository repo(db);
+        writer.writeRow({"id", "guest_id", "room_id", "check_in_date", "check_out_date", "num_adults",
+                         "num_children", "status", "special_requests", "total_amount"});
+        exported = repo.exportAll([&](const Booking& b) {
+            writer.writeRow({std::to_string(b.id), std::to_string(b.guestId), std::to_string(b.roomId),
+                             b.checkInDate.toString(), b.checkOutDate.toString(), std::to_string(b.numAdults),
+                             std::to_string(b.numChildren), b.statusToString(), b.specialRequests,
+                             std::to_string(b.totalAmount)});
+        });
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    out << "Exported " << exported << " rows in " << seconds << " s\n";
+    return static_cast<bool>(output);
+}
+
+} // namespace HotelManagement
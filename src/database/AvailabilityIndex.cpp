@@ -0,0 +1,505 @@
+#include "database/AvailabilityIndex.hpp"
+#include "database/OccupancyKernel.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+namespace HotelManagement {
+
+namespace {
+
+constexpr size_t BITS_PER_WORD = 64;
+
+inline bool testBit(const uint64_t* words, size_t slot) {
+    return (words[slot / BITS_PER_WORD] >> (slot % BITS_PER_WORD)) & 1u;
+}
+
+inline void setBit(uint64_t* words, size_t slot) {
+    words[slot / BITS_PER_WORD] |= uint64_t{1} << (slot % BITS_PER_WORD);
+}
+
+inline void clearBit(uint64_t* words, size_t slot) {
+    words[slot / BITS_PER_WORD] &= ~(uint64_t{1} << (slot % BITS_PER_WORD));
+}
+
+} // namespace
+
+AvailabilityIndex::AvailabilityIndex(int horizon) : horizonDays(std::max(1, horizon)) {}
+
+bool AvailabilityIndex::rebuild(CivilDate origin,
+                                const std::vector<RoomType>& roomTypes,
+                                const std::vector<Room>& rooms,
+                                const std::vector<Booking>& bookings) {
+    if (!origin.isValid()) {
+        Logger::error("AvailabilityIndex::rebuild: invalid origin date");
+        return false;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+
+    originDay = origin.daysSinceEpoch();
+    wordsPerDay = 0;
+    occupied.clear();
+    availableMask.clear();
+    slotByRoomId.clear();
+    roomIdBySlot.clear();
+    roomTypeBySlot.clear();
+    roomTypeMasks.clear();
+    maxOccupancyByType.clear();
+    freeSlots.clear();
+    staysByBookingId.clear();
+    bookingIdsByRoom.clear();
+    roomNumbers.clear();
+
+    for (const auto& roomType : roomTypes) {
+        maxOccupancyByType[roomType.id] = roomType.maxOccupancy;
+    }
+
+    growSlots(rooms.size());
+    for (const auto& room : rooms) {
+        size_t slot = slotFor(room.id);
+        setRoomStatus(slot, room.status);
+        setRoomType(slot, room.roomTypeId);
+        roomNumbers.assign(room.id, {room.roomNumber});
+    }
+
+    size_t indexed = 0;
+    for (const auto& booking : bookings) {
+        if (!blocksRoom(booking.status)) {
+            continue;
+        }
+        if (!booking.checkInDate.isValid() || booking.getDurationDays() <= 0) {
+            continue;
+        }
+        addStay(booking.id, toStay(booking));
+        indexed++;
+    }
+
+    // Changes that arrived while the rows were loading
+    size_t replayed = pendingChanges.size();
+    for (const auto& change : pendingChanges) {
+        change();
+    }
+    pendingChanges.clear();
+    rebuilding = false;
+
+    loaded = true;
+    Logger::info("AvailabilityIndex built: ", rooms.size(), " rooms, ", indexed,
+                 " bookings, ", horizonDays, " days from ", origin.toString(),
+                 " (", OccupancyKernel::getName(), " kernel, ", replayed, " changes replayed)");
+    return true;
+}
+
+bool AvailabilityIndex::isLoaded() const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+    return loaded;
+}
+
+void AvailabilityIndex::invalidate() {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    if (loaded) {
+        Logger::info("AvailabilityIndex invalidated, using database queries until rebuilt");
+    }
+    loaded = false;
+    rebuilding = false;
+    pendingChanges.clear();
+}
+
+void AvailabilityIndex::beginRebuild() {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    rebuilding = true;
+    pendingChanges.clear();
+}
+
+void AvailabilityIndex::advanceTo(CivilDate origin) {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    if (!loaded || !origin.isValid()) {
+        return;
+    }
+    int shift = origin.daysSinceEpoch() - originDay;
+    if (shift <= 0) {
+        return;
+    }
+
+    // Keep the days still covered, clear the ones entering at the end
+    int kept = std::max(horizonDays - shift, 0);
+    auto rows = occupied.begin();
+    if (kept > 0) {
+        std::copy(rows + static_cast<ptrdiff_t>(static_cast<size_t>(shift) * wordsPerDay), occupied.end(), rows);
+    }
+    std::fill(rows + static_cast<ptrdiff_t>(static_cast<size_t>(kept) * wordsPerDay), occupied.end(), 0);
+    originDay += shift;
+
+    // Forget stays that ended before the window; mark the rest on the new days
+    int newDaysStart = originDay + kept;
+    for (auto it = staysByBookingId.begin(); it != staysByBookingId.end();) {
+        const Stay& stay = it->second;
+        if (stay.endDay <= originDay) {
+            auto& roomBookings = bookingIdsByRoom[stay.roomId];
+            roomBookings.erase(std::remove(roomBookings.begin(), roomBookings.end(), it->first),
+                               roomBookings.end());
+            it = staysByBookingId.erase(it);
+            continue;
+        }
+        if (stay.endDay > newDaysStart) {
+            markDays(slotByRoomId.at(stay.roomId), std::max(stay.firstDay, newDaysStart), stay.endDay);
+        }
+        ++it;
+    }
+    Logger::info("AvailabilityIndex window moved to ", origin.toString());
+}
+
+void AvailabilityIndex::upsertRoomType(const RoomType& roomType) {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    apply([this, roomType] { maxOccupancyByType[roomType.id] = roomType.maxOccupancy; });
+}
+
+void AvailabilityIndex::upsertRoom(const Room& room) {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    apply([this, room] { applyRoom(room); });
+}
+
+void AvailabilityIndex::updateRoomStatus(int roomId, RoomStatus status) {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    apply([this, roomId, status] { setRoomStatus(slotFor(roomId), status); });
+}
+
+void AvailabilityIndex::removeRoom(int roomId) {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    apply([this, roomId] { applyRoomRemoval(roomId); });
+}
+
+void AvailabilityIndex::upsertBooking(const Booking& booking) {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    apply([this, booking] { applyBooking(booking); });
+}
+
+void AvailabilityIndex::removeBooking(int bookingId) {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    apply([this, bookingId] { dropStay(bookingId); });
+}
+
+std::optional<bool> AvailabilityIndex::isRoomAvailable(int roomId, const std::string& startDate,
+                                                       const std::string& endDate) const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+
+    int firstIndex = 0;
+    int endIndex = 0;
+    if (!loaded || !toWindow(startDate, endDate, firstIndex, endIndex)) {
+        return std::nullopt;
+    }
+
+    auto it = slotByRoomId.find(roomId);
+    if (it == slotByRoomId.end()) {
+        return true; // No bookings known for this room
+    }
+
+    for (int day = firstIndex; day < endIndex; day++) {
+        if (testBit(&occupied[static_cast<size_t>(day) * wordsPerDay], it->second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<std::vector<int>> AvailabilityIndex::getAvailableRoomIds(const std::string& startDate,
+                                                                       const std::string& endDate) const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+
+    int firstIndex = 0;
+    int endIndex = 0;
+    if (!loaded || !toWindow(startDate, endDate, firstIndex, endIndex)) {
+        return std::nullopt;
+    }
+    return searchWindow(availableMask, firstIndex, endIndex);
+}
+
+std::vector<std::optional<std::vector<int>>> AvailabilityIndex::findAvailableRooms(
+    const std::vector<AvailabilityQuery>& queries) const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+
+    std::vector<std::optional<std::vector<int>>> results;
+    results.reserve(queries.size());
+    for (const auto& query : queries) {
+        int firstIndex = 0;
+        int endIndex = 0;
+        if (!loaded || !toWindow(query.startDate, query.endDate, firstIndex, endIndex)) {
+            results.emplace_back(std::nullopt);
+            continue;
+        }
+        results.emplace_back(searchWindow(candidateMask(query.roomTypeId, query.minOccupancy),
+                                          firstIndex, endIndex));
+    }
+    return results;
+}
+
+std::optional<std::vector<Completion>> AvailabilityIndex::completeRoomNumber(std::string_view prefix,
+                                                                            size_t limit) const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+    if (!loaded) {
+        return std::nullopt;
+    }
+    return roomNumbers.complete(prefix, limit);
+}
+
+CivilDate AvailabilityIndex::getFirstDate() const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+    return CivilDate::fromDays(originDay);
+}
+
+CivilDate AvailabilityIndex::getEndDate() const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+    return CivilDate::fromDays(originDay + horizonDays);
+}
+
+// ==========================================
+// Unlocked helpers (callers hold indexMutex)
+// ==========================================
+
+// Changes made while the index is invalidated are dropped (the rebuild
+// loads them), except those that may postdate the rebuild's load
+void AvailabilityIndex::apply(std::function<void()> change) {
+    if (loaded) {
+        change();
+    } else if (rebuilding) {
+        pendingChanges.push_back(std::move(change));
+    }
+}
+
+void AvailabilityIndex::applyRoom(const Room& room) {
+    size_t slot = slotFor(room.id);
+    setRoomStatus(slot, room.status);
+    setRoomType(slot, room.roomTypeId);
+    roomNumbers.assign(room.id, {room.roomNumber});
+}
+
+void AvailabilityIndex::applyRoomRemoval(int roomId) {
+    auto it = slotByRoomId.find(roomId);
+    if (it == slotByRoomId.end()) {
+        return;
+    }
+    size_t slot = it->second;
+
+    auto bookingIt = bookingIdsByRoom.find(roomId);
+    if (bookingIt != bookingIdsByRoom.end()) {
+        for (int bookingId : bookingIt->second) {
+            staysByBookingId.erase(bookingId);
+        }
+        bookingIdsByRoom.erase(bookingIt);
+    }
+
+    for (int day = 0; day < horizonDays; day++) {
+        clearBit(&occupied[static_cast<size_t>(day) * wordsPerDay], slot);
+    }
+    clearBit(availableMask.data(), slot);
+    setRoomType(slot, 0);
+
+    roomIdBySlot[slot] = 0;
+    slotByRoomId.erase(it);
+    freeSlots.push_back(slot);
+    roomNumbers.remove(roomId);
+}
+
+void AvailabilityIndex::applyBooking(const Booking& booking) {
+    dropStay(booking.id);
+
+    if (!blocksRoom(booking.status)) {
+        return;
+    }
+    if (!booking.checkInDate.isValid() || booking.getDurationDays() <= 0) {
+        return;
+    }
+    addStay(booking.id, toStay(booking));
+}
+
+size_t AvailabilityIndex::slotFor(int roomId) {
+    auto it = slotByRoomId.find(roomId);
+    if (it != slotByRoomId.end()) {
+        return it->second;
+    }
+
+    size_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = roomIdBySlot.size();
+        growSlots(slot + 1);
+        roomIdBySlot.push_back(0);
+        roomTypeBySlot.push_back(0);
+    }
+
+    roomIdBySlot[slot] = roomId;
+    slotByRoomId[roomId] = slot;
+    return slot;
+}
+
+void AvailabilityIndex::growSlots(size_t minSlots) {
+    size_t neededWords = (minSlots + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    if (neededWords <= wordsPerDay && wordsPerDay > 0) {
+        return;
+    }
+
+    // Grow geometrically so adding rooms one at a time stays cheap, and keep
+    // rows a whole number of vector lanes for the search kernel
+    size_t newWords = std::max<size_t>({neededWords, wordsPerDay * 2, 1});
+    newWords = (newWords + OccupancyKernel::WORD_ALIGNMENT - 1) / OccupancyKernel::WORD_ALIGNMENT *
+               OccupancyKernel::WORD_ALIGNMENT;
+    std::vector<uint64_t> resized(static_cast<size_t>(horizonDays) * newWords, 0);
+    for (int day = 0; day < horizonDays && wordsPerDay > 0; day++) {
+        std::copy_n(&occupied[static_cast<size_t>(day) * wordsPerDay], wordsPerDay,
+                    &resized[static_cast<size_t>(day) * newWords]);
+    }
+
+    occupied.swap(resized);
+    availableMask.resize(newWords, 0);
+    for (auto& [typeId, mask] : roomTypeMasks) {
+        mask.resize(newWords, 0);
+    }
+    wordsPerDay = newWords;
+}
+
+void AvailabilityIndex::setRoomStatus(size_t slot, RoomStatus status) {
+    if (status == RoomStatus::Available) {
+        setBit(availableMask.data(), slot);
+    } else {
+        clearBit(availableMask.data(), slot);
+    }
+}
+
+void AvailabilityIndex::setRoomType(size_t slot, int roomTypeId) {
+    int previous = roomTypeBySlot[slot];
+    if (previous == roomTypeId) {
+        return;
+    }
+    if (previous != 0) {
+        clearBit(roomTypeMasks[previous].data(), slot);
+    }
+    if (roomTypeId != 0) {
+        auto& mask = roomTypeMasks[roomTypeId];
+        mask.resize(wordsPerDay, 0);
+        setBit(mask.data(), slot);
+    }
+    roomTypeBySlot[slot] = roomTypeId;
+}
+
+std::vector<uint64_t> AvailabilityIndex::candidateMask(int roomTypeId, int minOccupancy) const {
+    std::vector<uint64_t> candidates = availableMask;
+    if (roomTypeId == 0 && minOccupancy <= 0) {
+        return candidates;
+    }
+
+    // Union of the room types that satisfy the filter; rooms whose type is
+    // unknown never match (the SQL join drops them as well)
+    std::vector<uint64_t> allowed(wordsPerDay, 0);
+    for (const auto& [typeId, mask] : roomTypeMasks) {
+        if (roomTypeId != 0 && typeId != roomTypeId) {
+            continue;
+        }
+        if (minOccupancy > 0) {
+            auto it = maxOccupancyByType.find(typeId);
+            if (it == maxOccupancyByType.end() || it->second < minOccupancy) {
+                continue;
+            }
+        }
+        for (size_t w = 0; w < wordsPerDay; w++) {
+            allowed[w] |= mask[w];
+        }
+    }
+
+    for (size_t w = 0; w < wordsPerDay; w++) {
+        candidates[w] &= allowed[w];
+    }
+    return candidates;
+}
+
+std::vector<int> AvailabilityIndex::searchWindow(std::vector<uint64_t> candidates,
+                                                 int firstIndex, int endIndex) const {
+    // Knock out any candidate held on any night of the stay
+    OccupancyKernel::clearOccupied(candidates.data(),
+                                   &occupied[static_cast<size_t>(firstIndex) * wordsPerDay],
+                                   wordsPerDay, wordsPerDay,
+                                   static_cast<size_t>(endIndex - firstIndex));
+
+    std::vector<int> roomIds;
+    for (size_t w = 0; w < wordsPerDay; w++) {
+        uint64_t bits = candidates[w];
+        while (bits != 0) {
+            size_t slot = w * BITS_PER_WORD + static_cast<size_t>(std::countr_zero(bits));
+            roomIds.push_back(roomIdBySlot[slot]);
+            bits &= bits - 1;
+        }
+    }
+    std::sort(roomIds.begin(), roomIds.end());
+    return roomIds;
+}
+
+void AvailabilityIndex::addStay(int bookingId, const Stay& stay) {
+    size_t slot = slotFor(stay.roomId);
+    staysByBookingId[bookingId] = stay;
+    bookingIdsByRoom[stay.roomId].push_back(bookingId);
+    markDays(slot, stay.firstDay, stay.endDay);
+}
+
+void AvailabilityIndex::dropStay(int bookingId) {
+    auto it = staysByBookingId.find(bookingId);
+    if (it == staysByBookingId.end()) {
+        return;
+    }
+    Stay stay = it->second;
+    staysByBookingId.erase(it);
+
+    auto& roomBookings = bookingIdsByRoom[stay.roomId];
+    roomBookings.erase(std::remove(roomBookings.begin(), roomBookings.end(), bookingId),
+                       roomBookings.end());
+
+    // Clear the nights of this stay, then re-mark any other stay of the same
+    // room that overlaps them (double bookings are not prevented by the schema)
+    size_t slot = slotByRoomId.at(stay.roomId);
+    int first = std::max(stay.firstDay - originDay, 0);
+    int end = std::min(stay.endDay - originDay, horizonDays);
+    for (int day = first; day < end; day++) {
+        clearBit(&occupied[static_cast<size_t>(day) * wordsPerDay], slot);
+    }
+
+    for (int otherId : roomBookings) {
+        const Stay& other = staysByBookingId.at(otherId);
+        if (other.firstDay < stay.endDay && stay.firstDay < other.endDay) {
+            markDays(slot, std::max(other.firstDay, stay.firstDay), std::min(other.endDay, stay.endDay));
+        }
+    }
+}
+
+void AvailabilityIndex::markDays(size_t slot, int firstDay, int endDay) {
+    int first = std::max(firstDay - originDay, 0);
+    int end = std::min(endDay - originDay, horizonDays);
+    for (int day = first; day < end; day++) {
+        setBit(&occupied[static_cast<size_t>(day) * wordsPerDay], slot);
+    }
+}
+
+bool AvailabilityIndex::toWindow(const std::string& startDate, const std::string& endDate,
+                                 int& firstIndex, int& endIndex) const {
+    CivilDate start = CivilDate::parse(startDate);
+    CivilDate end = CivilDate::parse(endDate);
+
+    // Empty or inverted ranges follow SQL OVERLAPS edge cases; leave them to the database
+    if (!start.isValid() || !end.isValid() || end <= start) {
+        return false;
+    }
+
+    firstIndex = start.daysSinceEpoch() - originDay;
+    endIndex = end.daysSinceEpoch() - originDay;
+    return firstIndex >= 0 && endIndex <= horizonDays;
+}
+
+bool AvailabilityIndex::blocksRoom(BookingStatus status) {
+    return status != BookingStatus::Cancelled && status != BookingStatus::CheckedOut;
+}
+
+AvailabilityIndex::Stay AvailabilityIndex::toStay(const Booking& booking) {
+    return Stay{booking.roomId, booking.checkInDate.daysSinceEpoch(), booking.checkOutDate.daysSinceEpoch()};
+}
+
+} // namespace HotelManagement
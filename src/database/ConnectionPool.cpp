@@ -0,0 +1,207 @@
+#include "database/ConnectionPool.hpp"
+#include "database/StatementRegistry.hpp"
+#include "utils/Logger.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace HotelManagement {
+
+// ==========================================
+// ConnectionLease
+// ==========================================
+
+ConnectionLease::ConnectionLease(std::shared_ptr<ConnectionPool> owner, std::unique_ptr<PooledConnection> conn)
+    : pool(std::move(owner)), connection(std::move(conn)) {
+}
+
+ConnectionLease::~ConnectionLease() {
+    release();
+}
+
+ConnectionLease& ConnectionLease::operator=(ConnectionLease&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool = std::move(other.pool);
+        connection = std::move(other.connection);
+    }
+    return *this;
+}
+
+void ConnectionLease::release() {
+    if (pool && connection) {
+        pool->giveBack(std::move(connection));
+    }
+    connection.reset();
+    pool.reset();
+}
+
+// ==========================================
+// ConnectionPool
+// ==========================================
+
+ConnectionPool::ConnectionPool(std::string connStr, size_t maxConns, std::chrono::milliseconds timeout,
+                               std::shared_ptr<const StatementRegistry> registry)
+    : connectionString(std::move(connStr)),
+      maxConnections(maxConns > 0 ? maxConns : 1),
+      leaseTimeout(timeout),
+      statements(std::move(registry)) {
+    stats.maxConnections = maxConnections;
+}
+
+ConnectionPool::~ConnectionPool() {
+    close();
+}
+
+void ConnectionPool::warmUp() {
+    ConnectionLease lease = acquire();
+    Logger::info("PostgreSQL version: ", lease->server_version());
+}
+
+ConnectionLease ConnectionPool::acquire() {
+    auto waitStart = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(poolMutex);
+
+    auto canLease = [this] {
+        return closed || !idle.empty() || openCount < maxConnections;
+    };
+
+    if (!canLease()) {
+        stats.waiters++;
+        bool ready = available.wait_for(lock, leaseTimeout, canLease);
+        stats.waiters--;
+
+        if (!ready) {
+            stats.timeouts++;
+            throw std::runtime_error("Timed out waiting for a database connection");
+        }
+    }
+
+    if (closed) {
+        throw std::runtime_error("Database not connected");
+    }
+
+    double waitedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - waitStart).count();
+    stats.totalLeases++;
+    stats.totalWaitMs += waitedMs;
+    if (waitedMs > stats.maxWaitMs) {
+        stats.maxWaitMs = waitedMs;
+    }
+    stats.inUse++;
+    if (stats.inUse > stats.peakInUse) {
+        stats.peakInUse = stats.inUse;
+    }
+
+    // Reuse an idle connection if it is still usable
+    while (!idle.empty()) {
+        std::unique_ptr<PooledConnection> conn = std::move(idle.back());
+        idle.pop_back();
+
+        if (conn->connection->is_open()) {
+            lock.unlock();
+            return makeLease(std::move(conn));
+        }
+        openCount--;
+    }
+
+    // Otherwise open a new one outside the lock; connecting can take a while
+    openCount++;
+    lock.unlock();
+
+    std::unique_ptr<PooledConnection> conn;
+    try {
+        conn = openConnection();
+    } catch (...) {
+        lock.lock();
+        openCount--;
+        stats.inUse--;
+        available.notify_one();
+        throw;
+    }
+    return makeLease(std::move(conn));
+}
+
+ConnectionLease ConnectionPool::makeLease(std::unique_ptr<PooledConnection> conn) {
+    // The lease owns the connection from here on, so a failed prepare
+    // still returns it to the pool
+    ConnectionLease lease(shared_from_this(), std::move(conn));
+    if (statements) {
+        statements->prepareOn(*lease.connection->connection, lease.connection->preparedStatements);
+    }
+    return lease;
+}
+
+void ConnectionPool::close() {
+    std::vector<std::unique_ptr<PooledConnection>> toClose;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        closed = true;
+        toClose.swap(idle);
+        openCount -= toClose.size();
+    }
+    available.notify_all();
+
+    for (auto& conn : toClose) {
+        try {
+            conn->connection->close();
+        } catch (const std::exception& e) {
+            Logger::warning("ConnectionPool: error closing connection: ", e.what());
+        }
+    }
+}
+
+size_t ConnectionPool::discardIdle() {
+    std::vector<std::unique_ptr<PooledConnection>> toDrop;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        toDrop.swap(idle);
+        openCount -= toDrop.size();
+    }
+    // Waiters may now open connections of their own
+    available.notify_all();
+
+    if (!toDrop.empty()) {
+        Logger::info("ConnectionPool: dropped ", toDrop.size(), " idle connections");
+    }
+    return toDrop.size();
+}
+
+bool ConnectionPool::isClosed() const {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    return closed;
+}
+
+PoolStats ConnectionPool::getStats() const {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    PoolStats snapshot = stats;
+    snapshot.openConnections = openCount;
+    return snapshot;
+}
+
+void ConnectionPool::giveBack(std::unique_ptr<PooledConnection> conn) {
+    std::unique_ptr<PooledConnection> discarded;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        stats.inUse--;
+
+        if (closed || !conn->connection->is_open()) {
+            openCount--;
+            discarded = std::move(conn);
+        } else {
+            idle.push_back(std::move(conn));
+        }
+    }
+    available.notify_one();
+}
+
+std::unique_ptr<PooledConnection> ConnectionPool::openConnection() {
+    auto conn = std::make_unique<PooledConnection>();
+    conn->connection = std::make_unique<pqxx::connection>(connectionString);
+    if (!conn->connection->is_open()) {
+        throw pqxx::broken_connection("Failed to open database connection");
+    }
+    Logger::debug("ConnectionPool: opened connection (", maxConnections, " max)");
+    return conn;
+}
+
+} // namespace HotelManagement
@@ -1,14 +1,36 @@
 #include "database/DatabaseManager.hpp"
 #include "utils/Logger.hpp"
 #include <stdexcept>
+#include <algorithm>
+#include <random>
 
 namespace HotelManagement {
 
-DatabaseManager::DatabaseManager(const std::string& connStr)
-    : connectionString(connStr), connection(nullptr) {
+namespace {
+
+constexpr const char* RESERVE_IDS = "db_reserve_ids";
+
+// How long the listener blocks before rechecking for shutdown and new channels
+constexpr long LISTEN_POLL_MICROSECONDS = 250000;
+
+// Bounds how long a health check can hang on an unreachable server (and so
+// how long stopHealthChecks can wait); appended to Config's keyword=value string
+constexpr int PROBE_CONNECT_TIMEOUT_SECONDS = 5;
+
+} // namespace
+
+DatabaseManager::DatabaseManager(const std::string& connStr, size_t maxConns,
+                                 std::chrono::milliseconds timeout)
+    : connectionString(connStr), maxConnections(maxConns), leaseTimeout(timeout),
+      statementRegistry(std::make_shared<StatementRegistry>()) {
+    statementRegistry->add({
+        {RESERVE_IDS, "SELECT nextval(pg_get_serial_sequence($1, 'id')) FROM generate_series(1, $2)"},
+    });
 }
 
 DatabaseManager::~DatabaseManager() {
+    stopListener();
+    stopHealthChecks();
     disconnect();
 }
 
@@ -16,22 +38,19 @@ bool DatabaseManager::connect() {
     std::lock_guard<std::mutex> lock(dbMutex);
 
     try {
-        if (connection && connection->is_open()) {
+        if (pool && !pool->isClosed()) {
             Logger::info("Database already connected");
             return true;
         }
 
-        Logger::info("Connecting to database...");
-        connection = std::make_unique<pqxx::connection>(connectionString);
-
-        if (!connection->is_open()) {
-            logError("Failed to open database connection");
-            return false;
-        }
+        Logger::info("Connecting to database (pool size ", maxConnections, ")...");
+        auto newPool = std::make_shared<ConnectionPool>(connectionString, maxConnections, leaseTimeout,
+                                                        statementRegistry);
+        newPool->warmUp();
+        pool = newPool;
+        connectionState = ConnectionState::Connected;
 
         Logger::info("Database connected successfully");
-        Logger::info("PostgreSQL version: ", connection->server_version());
-
         return true;
 
     } catch (const pqxx::broken_connection& e) {
@@ -44,59 +63,409 @@ bool DatabaseManager::connect() {
 }
 
 void DatabaseManager::disconnect() {
-    std::lock_guard<std::mutex> lock(dbMutex);
+    // Otherwise the checker would report the closed pool as an outage
+    stopHealthChecks();
+
+    std::shared_ptr<ConnectionPool> oldPool;
+    {
+        std::lock_guard<std::mutex> lock(dbMutex);
+        oldPool.swap(pool);
+        connectionState = ConnectionState::Disconnected;
+    }
 
     try {
-        if (connection && connection->is_open()) {
-            connection->close();
+        if (oldPool) {
+            // Outstanding leases keep the pool alive; their connections are
+            // closed as they are returned
+            oldPool->close();
             Logger::info("Database disconnected");
         }
-        connection.reset();
     } catch (const std::exception& e) {
+        std::lock_guard<std::mutex> lock(dbMutex);
         logError(std::string("Disconnect error: ") + e.what());
     }
 }
 
 bool DatabaseManager::isConnected() const {
-    std::lock_guard<std::mutex> lock(dbMutex);
-    return connection && connection->is_open();
+    auto p = currentPool();
+    return p && !p->isClosed();
 }
 
-pqxx::connection& DatabaseManager::getConnection() {
-    std::lock_guard<std::mutex> lock(dbMutex);
+void DatabaseManager::registerStatements(const std::vector<PreparedStatement>& statements) {
+    statementRegistry->add(statements);
+}
 
-    if (!connection || !connection->is_open()) {
-        throw std::runtime_error("Database not connected. Call connect() first.");
+ConnectionLease DatabaseManager::acquireConnection() {
+    auto p = currentPool();
+    if (!p) {
+        throw std::runtime_error("Database not connected");
     }
+    if (connectionState == ConnectionState::Reconnecting) {
+        // Only the health checker dials a server known to be down
+        throw pqxx::broken_connection("Database connection lost, reconnecting");
+    }
+    return p->acquire();
+}
 
-    return *connection;
+void DatabaseManager::connectionLost() {
+    if (auto p = currentPool()) {
+        p->discardIdle();
+    }
+    {
+        std::lock_guard<std::mutex> lock(healthMutex);
+        healthCheckRequested = true;
+    }
+    healthWake.notify_all();
 }
 
-bool DatabaseManager::ping() {
-    try {
-        std::lock_guard<std::mutex> lock(dbMutex);
+bool DatabaseManager::waitToRetryRead(int attempt, const pqxx::broken_connection& error) {
+    int retries = readRetries.load();
+    if (attempt >= retries) {
+        return false;
+    }
+    Logger::warning("DatabaseManager: read lost its connection (", error.what(), "), retry ",
+                    attempt + 1, " of ", retries);
+    std::this_thread::sleep_for(reconnectDelay(attempt));
+    return true;
+}
+
+std::chrono::milliseconds DatabaseManager::reconnectDelay(int attempt) {
+    ReconnectOptions options;
+    {
+        std::lock_guard<std::mutex> lock(healthMutex);
+        options = reconnectOptions;
+    }
+
+    // Half the capped exponential delay, plus a random share of the other half
+    int64_t cap = std::max<int64_t>(options.maxBackoff.count(), 1);
+    int64_t delay = std::max<int64_t>(options.initialBackoff.count(), 1);
+    for (int i = 0; i < attempt && delay < cap; i++) {
+        delay *= 2;
+    }
+    delay = std::min(delay, cap);
+
+    thread_local std::mt19937 rng(std::random_device{}());
+    std::uniform_int_distribution<int64_t> jitter(0, delay / 2);
+    return std::chrono::milliseconds(delay - delay / 2 + jitter(rng));
+}
+
+std::vector<pqxx::result> DatabaseManager::executeBatch(const std::vector<std::string>& queries,
+                                                        std::source_location caller) {
+    if (queries.empty()) {
+        return {};
+    }
+
+    return executeReadTransaction([&](pqxx::nontransaction& txn) {
+        pqxx::pipeline pipe(txn);
+
+        // Hold every query back until complete() so they go out together
+        pipe.retain(static_cast<int>(queries.size()));
+
+        std::vector<pqxx::pipeline::query_id> ids;
+        ids.reserve(queries.size());
+        for (const auto& query : queries) {
+            ids.push_back(pipe.insert(query));
+        }
+        pipe.complete();
+
+        std::vector<pqxx::result> results;
+        results.reserve(ids.size());
+        for (auto id : ids) {
+            results.push_back(pipe.retrieve(id));
+        }
+        return results;
+    }, caller);
+}
+
+size_t DatabaseManager::streamQuery(const std::string& query, size_t batchSize,
+                                    const std::function<bool(const pqxx::row&)>& onRow,
+                                    std::source_location caller) {
+    batchSize = std::max<size_t>(batchSize, 1);
+
+    // Cursors only live inside a transaction block
+    return executeTransaction([&](pqxx::work& txn) {
+        txn.exec("DECLARE stream_cursor NO SCROLL CURSOR FOR " + query);
+        const std::string fetch = "FETCH FORWARD " + std::to_string(batchSize) + " FROM stream_cursor";
+
+        size_t visited = 0;
+        for (;;) {
+            pqxx::result batch = txn.exec(fetch);
+            for (const auto& row : batch) {
+                visited++;
+                if (!onRow(row)) {
+                    return visited;
+                }
+            }
+            if (static_cast<size_t>(batch.size()) < batchSize) {
+                return visited;
+            }
+        }
+    }, caller);
+}
+
+std::vector<int> DatabaseManager::reserveIds(pqxx::work& txn, const std::string& table, size_t count) {
+    std::vector<int> ids;
+    if (count == 0) {
+        return ids;
+    }
+
+    auto result = txn.exec_prepared(RESERVE_IDS, table, static_cast<int64_t>(count));
+    ids.reserve(static_cast<size_t>(result.size()));
+    for (const auto& row : result) {
+        ids.push_back(row[0].as<int>());
+    }
+    return ids;
+}
+
+int DatabaseManager::addNotificationHandler(const std::string& channel, NotificationHandler handler) {
+    std::lock_guard<std::mutex> lock(handlerMutex);
+    int id = nextHandlerId++;
+    handlers.push_back(HandlerEntry{id, channel, std::move(handler)});
+    channelsChanged = true;
+    return id;
+}
+
+void DatabaseManager::removeNotificationHandler(int handlerId) {
+    std::lock_guard<std::mutex> lock(handlerMutex);
+    handlers.erase(std::remove_if(handlers.begin(), handlers.end(),
+                                  [&](const HandlerEntry& entry) { return entry.id == handlerId; }),
+                   handlers.end());
+}
+
+void DatabaseManager::startListener() {
+    std::lock_guard<std::mutex> lock(listenerMutex);
+    if (listenerThread.joinable()) {
+        return;
+    }
+    listenerStopping = false;
+    listenerThread = std::thread(&DatabaseManager::listenerLoop, this);
+}
+
+void DatabaseManager::stopListener() {
+    {
+        std::lock_guard<std::mutex> lock(listenerMutex);
+        if (!listenerThread.joinable()) {
+            return;
+        }
+        listenerStopping = true;
+    }
+    listenerWake.notify_all();
+    listenerThread.join();
+}
+
+void DatabaseManager::dispatchNotification(const std::string& channel, const std::string& payload) {
+    std::lock_guard<std::mutex> lock(handlerMutex);
+    for (const auto& entry : handlers) {
+        if (!channel.empty() && entry.channel != channel) {
+            continue;
+        }
+        try {
+            entry.handler(payload);
+        } catch (const std::exception& e) {
+            Logger::error("DatabaseManager: notification handler for ", entry.channel, " failed: ", e.what());
+        }
+    }
+}
+
+std::vector<std::string> DatabaseManager::subscribedChannels() {
+    std::lock_guard<std::mutex> lock(handlerMutex);
+    std::vector<std::string> channels;
+    for (const auto& entry : handlers) {
+        if (std::find(channels.begin(), channels.end(), entry.channel) == channels.end()) {
+            channels.push_back(entry.channel);
+        }
+    }
+    return channels;
+}
+
+void DatabaseManager::listenerLoop() {
+    // Forwards one channel's notifications to the registered handlers
+    class Receiver : public pqxx::notification_receiver {
+    public:
+        Receiver(DatabaseManager& manager, pqxx::connection& conn, const std::string& channel)
+            : pqxx::notification_receiver(conn, channel), manager(manager), channelName(channel) {}
+
+        void operator()(const std::string& payload, int) override {
+            manager.dispatchNotification(channelName, payload);
+        }
+
+    private:
+        DatabaseManager& manager;
+        std::string channelName;
+    };
+
+    bool missedNotifications = false;
+    int failures = 0;
+    for (;;) {
+        try {
+            pqxx::connection conn(connectionString);
+            failures = 0;
+            std::vector<std::unique_ptr<Receiver>> receivers;
+            std::vector<std::string> listening;
+
+            for (;;) {
+                {
+                    std::lock_guard<std::mutex> lock(listenerMutex);
+                    if (listenerStopping) {
+                        return;
+                    }
+                }
 
-        if (!connection || !connection->is_open()) {
-            return false;
+                if (channelsChanged.exchange(false) || receivers.empty()) {
+                    for (const auto& channel : subscribedChannels()) {
+                        if (std::find(listening.begin(), listening.end(), channel) == listening.end()) {
+                            receivers.push_back(std::make_unique<Receiver>(*this, conn, channel));
+                            listening.push_back(channel);
+                        }
+                    }
+                }
+
+                if (missedNotifications) {
+                    // Changes made while we were not listening are unknown
+                    dispatchNotification("", "");
+                    missedNotifications = false;
+                    Logger::info("DatabaseManager: notification listener reconnected");
+                }
+
+                conn.await_notification(0, LISTEN_POLL_MICROSECONDS);
+            }
+        } catch (const std::exception& e) {
+            Logger::warning("DatabaseManager: notification listener error: ", e.what());
+            missedNotifications = true;
+        }
+
+        // Every LISTEN is issued again on the new connection
+        std::chrono::milliseconds delay = reconnectDelay(failures++);
+        std::unique_lock<std::mutex> lock(listenerMutex);
+        if (listenerWake.wait_for(lock, delay, [this]() { return listenerStopping; })) {
+            return;
         }
+    }
+}
+
+bool DatabaseManager::ping() {
+    try {
+        ConnectionLease lease = acquireConnection();
 
         // Execute a simple query to test connection
-        pqxx::nontransaction txn(*connection);
+        pqxx::nontransaction txn(*lease);
         pqxx::result result = txn.exec("SELECT 1");
 
         return !result.empty();
 
     } catch (const std::exception& e) {
+        std::lock_guard<std::mutex> lock(dbMutex);
         logError(std::string("Ping failed: ") + e.what());
         return false;
     }
 }
 
+void DatabaseManager::startHealthChecks(const ReconnectOptions& options) {
+    std::lock_guard<std::mutex> lock(healthMutex);
+    if (healthThread.joinable()) {
+        return;
+    }
+    reconnectOptions = options;
+    readRetries = std::max(0, options.readRetries);
+    healthStopping = false;
+    healthCheckRequested = false;
+    healthThread = std::thread(&DatabaseManager::healthLoop, this);
+}
+
+void DatabaseManager::stopHealthChecks() {
+    {
+        std::lock_guard<std::mutex> lock(healthMutex);
+        if (!healthThread.joinable()) {
+            return;
+        }
+        healthStopping = true;
+    }
+    healthWake.notify_all();
+    healthThread.join();
+}
+
+void DatabaseManager::healthLoop() {
+    // Probes run outside the pool, so a fully leased pool is not mistaken
+    // for an outage and a probe never queues behind slow queries
+    const std::string probeConnectionString =
+        connectionString + " connect_timeout=" + std::to_string(PROBE_CONNECT_TIMEOUT_SECONDS);
+    std::unique_ptr<pqxx::connection> probe;
+
+    int failures = 0;
+    auto outageStart = std::chrono::steady_clock::now();
+    for (;;) {
+        std::chrono::milliseconds delay;
+        {
+            std::lock_guard<std::mutex> lock(healthMutex);
+            delay = reconnectOptions.healthCheckInterval;
+        }
+        if (failures > 0) {
+            delay = reconnectDelay(failures - 1);
+        }
+
+        {
+            // Queries failing fast during an outage must not cut the backoff short
+            std::unique_lock<std::mutex> lock(healthMutex);
+            healthWake.wait_for(lock, delay, [&] { return healthStopping || (healthCheckRequested && failures == 0); });
+            if (healthStopping) {
+                return;
+            }
+            healthCheckRequested = false;
+        }
+
+        try {
+            if (!probe || !probe->is_open()) {
+                probe = std::make_unique<pqxx::connection>(probeConnectionString);
+            }
+            pqxx::nontransaction txn(*probe);
+            txn.exec("SELECT 1");
+        } catch (const std::exception& e) {
+            probe.reset();
+            if (failures++ == 0) {
+                outageStart = std::chrono::steady_clock::now();
+                connectionState = ConnectionState::Reconnecting;
+                if (auto p = currentPool()) {
+                    p->discardIdle();
+                }
+                std::lock_guard<std::mutex> lock(dbMutex);
+                logError(std::string("Connection lost, reconnecting: ") + e.what());
+            } else {
+                Logger::debug("DatabaseManager: reconnect attempt ", failures, " failed: ", e.what());
+            }
+            continue;
+        }
+
+        if (failures > 0) {
+            auto outage = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - outageStart);
+            Logger::info("DatabaseManager: reconnected after ", failures, " attempts (", outage.count(), " ms)");
+            failures = 0;
+            connectionState = ConnectionState::Connected;
+        }
+    }
+}
+
+PoolStats DatabaseManager::getPoolStats() const {
+    auto p = currentPool();
+    if (!p) {
+        PoolStats empty;
+        empty.maxConnections = maxConnections;
+        return empty;
+    }
+    return p->getStats();
+}
+
 std::string DatabaseManager::getLastError() const {
     std::lock_guard<std::mutex> lock(dbMutex);
     return lastError;
 }
 
+std::shared_ptr<ConnectionPool> DatabaseManager::currentPool() const {
+    std::lock_guard<std::mutex> lock(dbMutex);
+    return pool;
+}
+
+// Must be called with dbMutex held
 void DatabaseManager::logError(const std::string& error) {
     lastError = error;
     Logger::error("DatabaseManager: ", error);
@@ -0,0 +1,514 @@
+#include "database/GuestSearchIndex.hpp"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <mutex>
+
+namespace HotelManagement {
+
+namespace {
+
+// Trigrams are three 6-bit character codes
+constexpr size_t TRIGRAM_COUNT = size_t{1} << 18;
+
+// Retired slots are dropped once they are this many and a quarter of all slots
+constexpr size_t MIN_RETIRED_TO_COMPACT = 1024;
+
+constexpr uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+
+// Posting lists intersected per query, shortest first. Longer lists rarely
+// remove candidates the shorter ones kept; the substring check catches the rest.
+constexpr size_t MAX_INTERSECTED_LISTS = 3;
+
+// Candidates ahead of the one being scored whose document (and, half as far
+// ahead, text) is already requested from memory
+constexpr size_t PREFETCH_DISTANCE = 16;
+
+void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+uint32_t charCode(unsigned char c) {
+    if (c == ' ') return 0;
+    if (c >= 'a' && c <= 'z') return 1 + (c - 'a');
+    if (c >= '0' && c <= '9') return 27 + (c - '0');
+    switch (c) {
+    case '@': return 37;
+    case '.': return 38;
+    case '-': return 39;
+    case '_': return 40;
+    case '+': return 41;
+    case '\'': return 42;
+    default: break;
+    }
+    // UTF-8 bytes share the remaining codes; the substring check sorts out collisions
+    return c >= 0x80 ? 43 + (c % 20) : 63;
+}
+
+uint32_t trigramCode(unsigned char a, unsigned char b, unsigned char c) {
+    return (charCode(a) << 12) | (charCode(b) << 6) | charCode(c);
+}
+
+// ASCII lowercase with whitespace runs collapsed to one space and trimmed
+std::string normalize(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    bool pendingSpace = false;
+    for (unsigned char c : text) {
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            pendingSpace = !out.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            out.push_back(' ');
+            pendingSpace = false;
+        }
+        out.push_back(static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c));
+    }
+    return out;
+}
+
+std::string digitsOf(std::string_view text) {
+    std::string out;
+    for (char c : text) {
+        if (c >= '0' && c <= '9') out.push_back(c);
+    }
+    return out;
+}
+
+// Digits of a query that looks like a phone number, otherwise empty
+std::string phoneDigits(std::string_view query) {
+    for (char c : query) {
+        bool phoneChar = (c >= '0' && c <= '9') || c == '+' || c == '-' || c == ' ' ||
+                         c == '(' || c == ')' || c == '.';
+        if (!phoneChar) return {};
+    }
+    return digitsOf(query);
+}
+
+// Distinct trigrams of a query (unpadded: it may start mid-word)
+std::vector<uint32_t> trigramsOf(std::string_view query) {
+    std::vector<uint32_t> codes;
+    for (size_t i = 0; i + 3 <= query.size(); ++i) {
+        codes.push_back(trigramCode(static_cast<unsigned char>(query[i]),
+                                    static_cast<unsigned char>(query[i + 1]),
+                                    static_cast<unsigned char>(query[i + 2])));
+    }
+    return codes;
+}
+
+// Part of a field or query that is indexed: emails stop after the '@'
+std::string_view indexedPart(std::string_view text) {
+    size_t at = text.find('@');
+    return at == std::string_view::npos ? text : text.substr(0, at + 1);
+}
+
+// Trigrams of a field padded by two leading spaces, so word starts get their own entries
+void collectTrigrams(std::string_view field, std::vector<uint32_t>& codes) {
+    if (field.empty()) return;
+    unsigned char a = ' ';
+    unsigned char b = ' ';
+    for (unsigned char c : field) {
+        codes.push_back(trigramCode(a, b, c));
+        a = b;
+        b = c;
+    }
+}
+
+// Points for one field's match kind
+struct FieldWeights {
+    int exact;
+    int prefix;
+    int word;
+    int inner;
+};
+
+// Best of floor and the score of needle's best occurrence in field. Checks
+// that cannot beat floor are skipped, so fields after the first are cheap.
+int matchScore(std::string_view field, std::string_view needle, const FieldWeights& weights,
+               bool wordStartOnly, int floor) {
+    if (needle.empty() || field.size() < needle.size() || floor >= weights.exact) return floor;
+    if (field.size() == needle.size()) return field == needle ? weights.exact : floor;
+    if (field.substr(0, needle.size()) == needle) return std::max(floor, weights.prefix);
+    if (floor >= weights.word) return floor;
+
+    size_t pos = field.find(needle, 1);
+    if (pos == std::string_view::npos) return floor;
+    for (; pos != std::string_view::npos; pos = field.find(needle, pos + 1)) {
+        if (field[pos - 1] == ' ') return weights.word;
+    }
+    return wordStartOnly ? floor : std::max(floor, weights.inner);
+}
+
+constexpr FieldWeights NAME_WEIGHTS{100, 80, 70, 40};
+constexpr FieldWeights EMAIL_WEIGHTS{90, 60, 60, 30};
+constexpr FieldWeights PHONE_WEIGHTS{90, 50, 50, 35};
+
+// Best score a match inside a word can get
+constexpr int MAX_INNER_SCORE = std::max({NAME_WEIGHTS.inner, EMAIL_WEIGHTS.inner, PHONE_WEIGHTS.inner});
+
+std::string_view clampField(std::string_view field) {
+    return field.substr(0, std::numeric_limits<uint16_t>::max());
+}
+
+} // namespace
+
+GuestSearchIndex::GuestSearchIndex() {
+    contents.postings.resize(TRIGRAM_COUNT);
+}
+
+void GuestSearchIndex::rebuild(const std::function<void(const GuestVisitor&)>& scan) {
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        if (rebuildsInProgress++ == 0) {
+            pendingWrites.clear();
+        }
+    }
+
+    Contents built;
+    built.postings.resize(TRIGRAM_COUNT);
+    try {
+        scan([&](const Guest& guest) { addGuest(built, guest); });
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        if (--rebuildsInProgress == 0) {
+            pendingWrites.clear();
+        }
+        throw;
+    }
+    finishBuild(built);
+    built.loaded = true;
+
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    std::lock_guard<std::mutex> pendingLock(pendingMutex);
+    contents = std::move(built);
+
+    // Writes made while the scan ran may be missing from it
+    for (const auto& write : pendingWrites) {
+        if (write.guest) {
+            upsertLocked(*write.guest);
+        } else {
+            removeLocked(write.guestId);
+        }
+    }
+    if (--rebuildsInProgress == 0) {
+        pendingWrites.clear();
+    }
+}
+
+bool GuestSearchIndex::isLoaded() const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+    return contents.loaded;
+}
+
+void GuestSearchIndex::upsert(const Guest& guest) {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    upsertLocked(guest);
+
+    std::lock_guard<std::mutex> pendingLock(pendingMutex);
+    if (rebuildsInProgress > 0) {
+        pendingWrites.push_back({guest.id, guest});
+    }
+}
+
+void GuestSearchIndex::remove(int guestId) {
+    std::unique_lock<std::shared_mutex> lock(indexMutex);
+    removeLocked(guestId);
+
+    std::lock_guard<std::mutex> pendingLock(pendingMutex);
+    if (rebuildsInProgress > 0) {
+        pendingWrites.push_back({guestId, std::nullopt});
+    }
+}
+
+void GuestSearchIndex::upsertLocked(const Guest& guest) {
+    if (guest.id <= 0) return;
+    uint32_t slot = slotOf(contents, guest.id);
+    if (slot != NO_SLOT) {
+        retire(slot);
+    }
+    addGuest(contents, guest);
+    compactIfNeeded();
+}
+
+void GuestSearchIndex::removeLocked(int guestId) {
+    uint32_t slot = slotOf(contents, guestId);
+    if (slot == NO_SLOT) return;
+    retire(slot);
+    contents.slotByGuest[guestId] = NO_SLOT;
+    contents.names.remove(guestId);
+    compactIfNeeded();
+}
+
+std::optional<std::vector<GuestMatch>> GuestSearchIndex::search(std::string_view query, size_t limit) const {
+    std::string text = normalize(query);
+    std::string digits = phoneDigits(text);
+    if (digits.size() < 3 || digits == text) {
+        digits.clear();
+    }
+
+    std::string_view indexed = indexedPart(text);
+    if (indexed.size() < 2) {
+        return std::nullopt;
+    }
+    bool wordStartOnly = text.size() == 2;
+
+    std::vector<std::string_view> needles{indexed};
+    if (!digits.empty()) {
+        needles.push_back(digits);
+    }
+
+    // Phone fields hold digits only, so other queries can skip them
+    bool allDigits = std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; });
+    std::string_view phone = !digits.empty() ? std::string_view(digits)
+                           : allDigits       ? std::string_view(text)
+                                             : std::string_view();
+
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+    if (!contents.loaded) {
+        return std::nullopt;
+    }
+
+    // Keep the best `limit` matches in a heap whose top is the worst kept.
+    // Ties go to the shorter name (the closer match), then the lower id.
+    struct Ranked {
+        int score;
+        uint16_t nameLength;
+        int guestId;
+    };
+    auto better = [](const Ranked& a, const Ranked& b) {
+        if (a.score != b.score) return a.score > b.score;
+        if (a.nameLength != b.nameLength) return a.nameLength < b.nameLength;
+        return a.guestId < b.guestId;
+    };
+    std::vector<Ranked> best;
+    std::vector<uint32_t> scored; // sorted slots already ranked
+
+    auto rank = [&](std::vector<uint32_t> slots) {
+        if (!scored.empty()) {
+            std::vector<uint32_t> fresh;
+            std::set_difference(slots.begin(), slots.end(), scored.begin(), scored.end(), std::back_inserter(fresh));
+            slots.swap(fresh);
+        }
+
+        for (size_t i = 0; i < slots.size(); ++i) {
+            // Scoring is bound by random reads of documents spread over the whole index
+            if (i + PREFETCH_DISTANCE < slots.size()) {
+                prefetch(&contents.documents[slots[i + PREFETCH_DISTANCE]]);
+            }
+            if (i + PREFETCH_DISTANCE / 2 < slots.size()) {
+                prefetch(contents.text.data() + contents.documents[slots[i + PREFETCH_DISTANCE / 2]].offset);
+            }
+
+            const Document& document = contents.documents[slots[i]];
+            if (!document.alive) continue;
+            int value = score(document, text, phone, wordStartOnly);
+            if (value <= 0) continue;
+
+            Ranked candidate{value, document.nameLength, document.guestId};
+            if (best.size() < limit) {
+                best.push_back(candidate);
+                std::push_heap(best.begin(), best.end(), better);
+            } else if (limit > 0 && better(candidate, best.front())) {
+                std::pop_heap(best.begin(), best.end(), better);
+                best.back() = candidate;
+                std::push_heap(best.begin(), best.end(), better);
+            }
+        }
+
+        std::vector<uint32_t> merged;
+        merged.reserve(scored.size() + slots.size());
+        std::merge(scored.begin(), scored.end(), slots.begin(), slots.end(), std::back_inserter(merged));
+        scored.swap(merged);
+    };
+
+    // Every exact, prefix and word-start match contains a space followed by
+    // the needle's first two characters (fields are space-padded), so those
+    // candidates are scored first
+    for (std::string_view needle : needles) {
+        std::vector<uint32_t> codes = trigramsOf(needle);
+        codes.push_back(trigramCode(' ', static_cast<unsigned char>(needle[0]), static_cast<unsigned char>(needle[1])));
+        rank(candidates(std::move(codes)));
+    }
+
+    // Matches inside words score lower; only look for them if they can still make the cut
+    bool settled = limit > 0 && best.size() == limit && best.front().score > MAX_INNER_SCORE;
+    if (!wordStartOnly && !settled) {
+        for (std::string_view needle : needles) {
+            rank(candidates(trigramsOf(needle)));
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end(), better);
+
+    std::vector<GuestMatch> matches;
+    matches.reserve(best.size());
+    for (const Ranked& ranked : best) {
+        matches.push_back({ranked.guestId, ranked.score});
+    }
+    return matches;
+}
+
+std::optional<std::vector<Completion>> GuestSearchIndex::completeName(std::string_view prefix, size_t limit) const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+    if (!contents.loaded) {
+        return std::nullopt;
+    }
+    return contents.names.complete(prefix, limit);
+}
+
+size_t GuestSearchIndex::size() const {
+    std::shared_lock<std::shared_mutex> lock(indexMutex);
+    return contents.live;
+}
+
+void GuestSearchIndex::addDocument(Contents& target, int guestId, std::string_view name,
+                                   std::string_view email, std::string_view phone) {
+    name = clampField(name);
+    email = clampField(email);
+    phone = clampField(phone);
+
+    uint32_t slot = static_cast<uint32_t>(target.documents.size());
+    Document document;
+    document.guestId = guestId;
+    document.offset = static_cast<uint32_t>(target.text.size());
+    document.nameLength = static_cast<uint16_t>(name.size());
+    document.emailLength = static_cast<uint16_t>(email.size());
+    document.phoneLength = static_cast<uint16_t>(phone.size());
+    document.alive = true;
+    target.documents.push_back(document);
+    target.text.append(name).append(email).append(phone);
+
+    thread_local std::vector<uint32_t> codes;
+    codes.clear();
+    collectTrigrams(name, codes);
+    collectTrigrams(indexedPart(email), codes);
+    collectTrigrams(phone, codes);
+    std::sort(codes.begin(), codes.end());
+    codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+    for (uint32_t code : codes) {
+        target.postings[code].push_back(slot);
+    }
+
+    if (static_cast<size_t>(guestId) >= target.slotByGuest.size()) {
+        target.slotByGuest.resize(std::max<size_t>(guestId + 1, target.slotByGuest.size() * 3 / 2), NO_SLOT);
+    }
+    target.slotByGuest[guestId] = slot;
+    target.live++;
+}
+
+void GuestSearchIndex::addGuest(Contents& target, const Guest& guest) {
+    std::string name = normalize(guest.firstName + " " + guest.lastName);
+    std::string email = normalize(guest.email);
+    std::string phone = digitsOf(guest.phone);
+    addDocument(target, guest.id, name, email, phone);
+    target.names.assign(guest.id, {guest.firstName, guest.lastName});
+}
+
+// Drop the slack left by growing the posting lists one slot at a time
+void GuestSearchIndex::finishBuild(Contents& target) {
+    for (auto& list : target.postings) {
+        list.shrink_to_fit();
+    }
+    target.text.shrink_to_fit();
+    target.documents.shrink_to_fit();
+}
+
+uint32_t GuestSearchIndex::slotOf(const Contents& target, int guestId) {
+    if (guestId <= 0 || static_cast<size_t>(guestId) >= target.slotByGuest.size()) {
+        return NO_SLOT;
+    }
+    return target.slotByGuest[guestId];
+}
+
+void GuestSearchIndex::retire(uint32_t slot) {
+    Document& document = contents.documents[slot];
+    if (document.alive) {
+        document.alive = false;
+        contents.retired++;
+        contents.live--;
+    }
+}
+
+void GuestSearchIndex::compactIfNeeded() {
+    if (contents.retired < MIN_RETIRED_TO_COMPACT || contents.retired * 4 < contents.documents.size()) {
+        return;
+    }
+
+    Contents compacted;
+    compacted.postings.resize(TRIGRAM_COUNT);
+    compacted.loaded = contents.loaded;
+    std::string_view text(contents.text);
+    for (const Document& document : contents.documents) {
+        if (!document.alive) continue;
+        std::string_view fields = text.substr(document.offset);
+        addDocument(compacted, document.guestId,
+                    fields.substr(0, document.nameLength),
+                    fields.substr(document.nameLength, document.emailLength),
+                    fields.substr(document.nameLength + document.emailLength, document.phoneLength));
+    }
+    finishBuild(compacted);
+    compacted.names = std::move(contents.names);
+    contents = std::move(compacted);
+}
+
+std::vector<uint32_t> GuestSearchIndex::candidates(std::vector<uint32_t> codes) const {
+    if (codes.empty()) {
+        return {};
+    }
+    std::sort(codes.begin(), codes.end());
+    codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+
+    // Intersect the posting lists, shortest first
+    std::vector<const std::vector<uint32_t>*> lists;
+    for (uint32_t code : codes) {
+        const auto& list = contents.postings[code];
+        if (list.empty()) return {};
+        lists.push_back(&list);
+    }
+    std::sort(lists.begin(), lists.end(), [](const auto* a, const auto* b) { return a->size() < b->size(); });
+
+    std::vector<uint32_t> result = *lists.front();
+    size_t listCount = std::min(lists.size(), MAX_INTERSECTED_LISTS);
+    for (size_t i = 1; i < listCount && !result.empty(); ++i) {
+        const std::vector<uint32_t>& list = *lists[i];
+        auto from = list.begin();
+        size_t kept = 0;
+        for (uint32_t slot : result) {
+            // Gallop ahead: the surviving slots are sparse in the longer list
+            auto low = from;
+            auto high = from;
+            size_t step = 1;
+            while (high != list.end() && *high < slot) {
+                low = high;
+                high = static_cast<size_t>(list.end() - high) > step ? high + step : list.end();
+                step *= 2;
+            }
+            from = std::lower_bound(low, high, slot);
+            if (from == list.end()) break;
+            if (*from == slot) {
+                result[kept++] = slot;
+            }
+        }
+        result.resize(kept);
+    }
+    return result;
+}
+
+int GuestSearchIndex::score(const Document& document, std::string_view query, std::string_view phone,
+                            bool wordStartOnly) const {
+    std::string_view fields = std::string_view(contents.text).substr(document.offset);
+    std::string_view name = fields.substr(0, document.nameLength);
+    std::string_view email = fields.substr(document.nameLength, document.emailLength);
+    std::string_view phoneDigits = fields.substr(document.nameLength + document.emailLength, document.phoneLength);
+
+    int best = matchScore(name, query, NAME_WEIGHTS, wordStartOnly, 0);
+    best = matchScore(email, query, EMAIL_WEIGHTS, wordStartOnly, best);
+    return matchScore(phoneDigits, phone, PHONE_WEIGHTS, wordStartOnly, best);
+}
+
+} // namespace HotelManagement
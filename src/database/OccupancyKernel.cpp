@@ -0,0 +1,92 @@
+#include "database/OccupancyKernel.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define HOTEL_OCCUPANCY_X86 1
+#include <immintrin.h>
+#endif
+
+namespace HotelManagement {
+
+namespace {
+
+using ClearFn = void (*)(uint64_t*, const uint64_t*, size_t, size_t, size_t);
+
+#ifndef HOTEL_OCCUPANCY_X86
+
+void clearScalar(uint64_t* candidates, const uint64_t* rows, size_t words, size_t stride, size_t rowCount) {
+    for (size_t r = 0; r < rowCount; r++) {
+        const uint64_t* row = rows + r * stride;
+        for (size_t w = 0; w < words; w++) {
+            candidates[w] &= ~row[w];
+        }
+    }
+}
+
+#else
+
+// SSE2 is part of the x86-64 baseline, so this needs no runtime check
+void clearSse2(uint64_t* candidates, const uint64_t* rows, size_t words, size_t stride, size_t rowCount) {
+    size_t vectorWords = words & ~size_t{1};
+    for (size_t r = 0; r < rowCount; r++) {
+        const uint64_t* row = rows + r * stride;
+        for (size_t w = 0; w < vectorWords; w += 2) {
+            auto* target = reinterpret_cast<__m128i*>(candidates + w);
+            __m128i occupied = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + w));
+            _mm_storeu_si128(target, _mm_andnot_si128(occupied, _mm_loadu_si128(target)));
+        }
+        for (size_t w = vectorWords; w < words; w++) {
+            candidates[w] &= ~row[w];
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+void clearAvx2(uint64_t* candidates, const uint64_t* rows, size_t words, size_t stride, size_t rowCount) {
+    size_t vectorWords = words & ~size_t{3};
+    for (size_t r = 0; r < rowCount; r++) {
+        const uint64_t* row = rows + r * stride;
+        for (size_t w = 0; w < vectorWords; w += 4) {
+            auto* target = reinterpret_cast<__m256i*>(candidates + w);
+            __m256i occupied = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + w));
+            _mm256_storeu_si256(target, _mm256_andnot_si256(occupied, _mm256_loadu_si256(target)));
+        }
+        for (size_t w = vectorWords; w < words; w++) {
+            candidates[w] &= ~row[w];
+        }
+    }
+}
+
+#endif
+
+struct Dispatch {
+    ClearFn clear;
+    const char* name;
+};
+
+const Dispatch& selected() {
+    static const Dispatch dispatch = [] {
+#ifdef HOTEL_OCCUPANCY_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return Dispatch{clearAvx2, "avx2"};
+        }
+        return Dispatch{clearSse2, "sse2"};
+#else
+        return Dispatch{clearScalar, "scalar"};
+#endif
+    }();
+    return dispatch;
+}
+
+} // namespace
+
+void OccupancyKernel::clearOccupied(uint64_t* candidates, const uint64_t* rows,
+                                    size_t words, size_t stride, size_t rowCount) {
+    selected().clear(candidates, rows, words, stride, rowCount);
+}
+
+const char* OccupancyKernel::getName() {
+    return selected().name;
+}
+
+} // namespace HotelManagement
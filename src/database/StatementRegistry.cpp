@@ -0,0 +1,45 @@
+#include "database/StatementRegistry.hpp"
+#include <stdexcept>
+
+namespace HotelManagement {
+
+void StatementRegistry::add(const std::vector<PreparedStatement>& newStatements) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    for (const auto& statement : newStatements) {
+        auto it = byName.find(statement.name);
+        if (it != byName.end()) {
+            if (statements[it->second].sql != statement.sql) {
+                throw std::invalid_argument("Prepared statement registered twice with different SQL: " +
+                                            statement.name);
+            }
+            continue;
+        }
+
+        byName.emplace(statement.name, statements.size());
+        statements.push_back(statement);
+    }
+}
+
+void StatementRegistry::prepareOn(pqxx::connection& conn, size_t& preparedCount) const {
+    std::vector<PreparedStatement> pending;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        if (preparedCount >= statements.size()) {
+            return;
+        }
+        pending.assign(statements.begin() + static_cast<std::ptrdiff_t>(preparedCount), statements.end());
+    }
+
+    for (const auto& statement : pending) {
+        conn.prepare(statement.name, statement.sql);
+        preparedCount++;
+    }
+}
+
+size_t StatementRegistry::size() const {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return statements.size();
+}
+
+} // namespace HotelManagement
@@ -1,48 +1,193 @@
 #include "database/repositories/BookingRepository.hpp"
+#include "database/RowMapper.hpp"
 #include "utils/Logger.hpp"
 #include "utils/DateUtils.hpp"
+#include <algorithm>
 
 namespace HotelManagement {
 
-BookingRepository::BookingRepository(DatabaseManager& db) : dbManager(db) {}
+namespace {
+
+// Prepared statement names
+constexpr const char* FIND_BY_ID = "booking_find_by_id";
+constexpr const char* FIND_BY_IDS = "booking_find_by_ids";
+constexpr const char* FIND_ALL = "booking_find_all";
+constexpr const char* FIRST_PAGE = "booking_first_page";
+constexpr const char* NEXT_PAGE = "booking_next_page";
+constexpr const char* FIND_BY_STATUS = "booking_find_by_status";
+constexpr const char* FIND_ACTIVE_FROM = "booking_find_active_from";
+constexpr const char* CREATE = "booking_create";
+constexpr const char* UPDATE = "booking_update";
+constexpr const char* DELETE_BY_ID = "booking_delete_by_id";
+constexpr const char* CHECK_IN = "booking_check_in";
+constexpr const char* CHECK_OUT = "booking_check_out";
+constexpr const char* COUNT_ACTIVE = "booking_count_active";
+constexpr const char* COUNT_TODAY_CHECK_INS = "booking_count_today_check_ins";
+constexpr const char* COUNT_TODAY_CHECK_OUTS = "booking_count_today_check_outs";
+
+// NOTIFY channels of the bookings row-change and insert triggers
+constexpr const char* CHANGED_CHANNEL = "bookings_changed";
+constexpr const char* INSERTED_CHANNEL = "bookings_inserted";
+
+constexpr TableSchema BOOKING_SCHEMA("bookings", std::to_array<std::string_view>({
+    "id", "guest_id", "room_id", "check_in_date", "check_out_date", "actual_check_in",
+    "actual_check_out", "num_adults", "num_children", "status", "special_requests", "total_amount",
+    "created_at", "updated_at"}));
+
+// Select-list positions
+constexpr int COL_ID = BOOKING_SCHEMA.column("id");
+constexpr int COL_GUEST_ID = BOOKING_SCHEMA.column("guest_id");
+constexpr int COL_ROOM_ID = BOOKING_SCHEMA.column("room_id");
+constexpr int COL_CHECK_IN_DATE = BOOKING_SCHEMA.column("check_in_date");
+constexpr int COL_CHECK_OUT_DATE = BOOKING_SCHEMA.column("check_out_date");
+constexpr int COL_ACTUAL_CHECK_IN = BOOKING_SCHEMA.column("actual_check_in");
+constexpr int COL_ACTUAL_CHECK_OUT = BOOKING_SCHEMA.column("actual_check_out");
+constexpr int COL_NUM_ADULTS = BOOKING_SCHEMA.column("num_adults");
+constexpr int COL_NUM_CHILDREN = BOOKING_SCHEMA.column("num_children");
+constexpr int COL_STATUS = BOOKING_SCHEMA.column("status");
+constexpr int COL_SPECIAL_REQUESTS = BOOKING_SCHEMA.column("special_requests");
+constexpr int COL_TOTAL_AMOUNT = BOOKING_SCHEMA.column("total_amount");
+constexpr int COL_CREATED_AT = BOOKING_SCHEMA.column("created_at");
+constexpr int COL_UPDATED_AT = BOOKING_SCHEMA.column("updated_at");
+
+const std::string BOOKING_SELECT = BOOKING_SCHEMA.selectSql();
+
+const std::string BOOKING_ORDER = "ORDER BY check_in_date DESC, id DESC";
+
+size_t bookingHeapBytes(const Booking& booking) {
+    return heapBytes(booking.actualCheckIn) + heapBytes(booking.actualCheckOut) +
+           heapBytes(booking.specialRequests) + heapBytes(booking.createdAt) +
+           heapBytes(booking.updatedAt);
+}
+
+} // namespace
+
+BookingRepository::BookingRepository(DatabaseManager& db, size_t cacheBytes)
+    : dbManager(db), bookingCache(cacheBytes, bookingHeapBytes) {
+    dbManager.registerStatements({
+        {FIND_BY_ID, BOOKING_SELECT + "WHERE id = $1"},
+        {FIND_BY_IDS, BOOKING_SELECT + "WHERE id = ANY($1::int[])"},
+        {FIND_ALL, BOOKING_SELECT + BOOKING_ORDER},
+        {FIRST_PAGE, BOOKING_SELECT + BOOKING_ORDER + " LIMIT $1"},
+        {NEXT_PAGE, BOOKING_SELECT + "WHERE (check_in_date, id) < ($1::date, $2) " +
+                    BOOKING_ORDER + " LIMIT $3"},
+        {FIND_BY_STATUS, BOOKING_SELECT + "WHERE status = $1"},
+        {CREATE, "INSERT INTO bookings (guest_id, room_id, check_in_date, check_out_date, "
+                 "num_adults, num_children, status, special_requests, total_amount) "
+                 "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9) RETURNING id"},
+        {FIND_ACTIVE_FROM, BOOKING_SELECT + "WHERE status NOT IN ('cancelled', 'checked_out') "
+                           "AND check_out_date > $1"},
+        {UPDATE, "UPDATE bookings SET guest_id = $1, room_id = $2, check_in_date = $3, "
+                 "check_out_date = $4, num_adults = $5, num_children = $6, status = $7, "
+                 "special_requests = $8, total_amount = $9 WHERE id = $10"},
+        {DELETE_BY_ID, "DELETE FROM bookings WHERE id = $1"},
+        {CHECK_IN, "UPDATE bookings SET status = 'checked_in', actual_check_in = $1 WHERE id = $2"},
+        {CHECK_OUT, "UPDATE bookings SET status = 'checked_out', actual_check_out = $1 WHERE id = $2"},
+        {COUNT_ACTIVE, "SELECT COUNT(*) FROM bookings WHERE status IN ('confirmed', 'checked_in')"},
+        {COUNT_TODAY_CHECK_INS, "SELECT COUNT(*) FROM bookings WHERE check_in_date = CURRENT_DATE "
+                                "AND status IN ('confirmed', 'checked_in')"},
+        {COUNT_TODAY_CHECK_OUTS, "SELECT COUNT(*) FROM bookings WHERE check_out_date = CURRENT_DATE "
+                                 "AND status = 'checked_in'"},
+    });
+
+    handlerId = dbManager.addNotificationHandler(CHANGED_CHANNEL, [this](const std::string& payload) {
+        bookingCache.applyNotification(payload);
+        refreshAvailability(payload);
+    });
+    insertHandlerId = dbManager.addNotificationHandler(INSERTED_CHANNEL, [this](const std::string& payload) {
+        refreshAvailability(payload);
+    });
+}
+
+BookingRepository::~BookingRepository() {
+    dbManager.removeNotificationHandler(handlerId);
+    dbManager.removeNotificationHandler(insertHandlerId);
+}
 
 std::optional<Booking> BookingRepository::findById(int id) {
+    return bookingCache.getOrLoad(id, [&]() -> std::optional<Booking> {
+        try {
+            return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) -> std::optional<Booking> {
+                auto result = txn.exec_prepared(FIND_BY_ID, id);
+                if (result.empty()) return std::nullopt;
+                return rowToBooking(result[0]);
+            });
+        } catch (const std::exception& e) {
+            Logger::error("BookingRepository::findById failed: ", e.what());
+            return std::nullopt;
+        }
+    });
+}
+
+void BookingRepository::primeCache(const std::vector<Booking>& bookings) {
+    for (const auto& booking : bookings) {
+        bookingCache.prime(booking.id, booking);
+    }
+}
+
+CacheStats BookingRepository::getCacheStats() const {
+    return bookingCache.getStats();
+}
+
+std::vector<Booking> BookingRepository::findAll() {
     try {
-        return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) -> std::optional<Booking> {
-            auto result = txn.exec_params(
-                "SELECT id, guest_id, room_id, check_in_date, check_out_date, actual_check_in, "
-                "actual_check_out, num_adults, num_children, status, special_requests, total_amount, "
-                "created_at, updated_at FROM bookings WHERE id = $1", id
-            );
-            if (result.empty()) return std::nullopt;
-            return rowToBooking(result[0]);
-        });
+        return loadAll();
     } catch (const std::exception& e) {
-        Logger::error("BookingRepository::findById failed: ", e.what());
-        return std::nullopt;
+        Logger::error("BookingRepository::findAll failed: ", e.what());
+        return {};
     }
 }
 
-std::vector<Booking> BookingRepository::findAll() {
+std::vector<Booking> BookingRepository::loadAll() {
+    return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+        auto result = txn.exec_prepared(FIND_ALL);
+        std::vector<Booking> bookings;
+        for (const auto& row : result) {
+            bookings.push_back(rowToBooking(row));
+        }
+        return bookings;
+    });
+}
+
+BookingPage BookingRepository::findPage(const std::optional<BookingKey>& after, size_t limit) {
     try {
+        // Fetch one extra row to learn whether another page follows
+        auto fetchCount = static_cast<int64_t>(limit) + 1;
+
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec(
-                "SELECT id, guest_id, room_id, check_in_date, check_out_date, actual_check_in, "
-                "actual_check_out, num_adults, num_children, status, special_requests, total_amount, "
-                "created_at, updated_at FROM bookings ORDER BY check_in_date DESC"
-            );
-            std::vector<Booking> bookings;
+            auto result = after.has_value()
+                ? txn.exec_prepared(NEXT_PAGE, after->checkInDate.toString(), after->id, fetchCount)
+                : txn.exec_prepared(FIRST_PAGE, fetchCount);
+
+            BookingPage page;
+            page.items.reserve(std::min(static_cast<size_t>(result.size()), limit));
             for (const auto& row : result) {
-                bookings.push_back(rowToBooking(row));
+                if (page.items.size() == limit) {
+                    const Booking& last = page.items.back();
+                    page.nextKey = BookingKey{last.checkInDate, last.id};
+                    break;
+                }
+                page.items.push_back(rowToBooking(row));
             }
-            return bookings;
+            return page;
         });
     } catch (const std::exception& e) {
-        Logger::error("BookingRepository::findAll failed: ", e.what());
+        Logger::error("BookingRepository::findPage failed: ", e.what());
         return {};
     }
 }
 
+size_t BookingRepository::forEach(const std::function<bool(const Booking&)>& visitor, size_t batchSize) {
+    try {
+        return dbManager.streamQuery(BOOKING_SELECT + BOOKING_ORDER, batchSize, [&](const pqxx::row& row) {
+            return visitor(rowToBooking(row));
+        });
+    } catch (const std::exception& e) {
+        Logger::error("BookingRepository::forEach failed: ", e.what());
+        return 0;
+    }
+}
+
 std::vector<Booking> BookingRepository::findByStatus(BookingStatus status) {
     try {
         Booking temp;
@@ -50,11 +195,7 @@ std::vector<Booking> BookingRepository::findByStatus(BookingStatus status) {
         std::string statusStr = temp.statusToString();
 
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec_params(
-                "SELECT id, guest_id, room_id, check_in_date, check_out_date, actual_check_in, "
-                "actual_check_out, num_adults, num_children, status, special_requests, total_amount, "
-                "created_at, updated_at FROM bookings WHERE status = $1", statusStr
-            );
+            auto result = txn.exec_prepared(FIND_BY_STATUS, statusStr);
             std::vector<Booking> bookings;
             for (const auto& row : result) {
                 bookings.push_back(rowToBooking(row));
@@ -66,19 +207,127 @@ std::vector<Booking> BookingRepository::findByStatus(BookingStatus status) {
     }
 }
 
+std::vector<Booking> BookingRepository::findActiveFrom(CivilDate date) {
+    try {
+        return loadActiveFrom(date);
+    } catch (const std::exception& e) {
+        Logger::error("BookingRepository::findActiveFrom failed: ", e.what());
+        return {};
+    }
+}
+
+std::vector<Booking> BookingRepository::loadActiveFrom(CivilDate date) {
+    return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+        auto result = txn.exec_prepared(FIND_ACTIVE_FROM, date.toString());
+        std::vector<Booking> bookings;
+        bookings.reserve(result.size());
+        for (const auto& row : result) {
+            bookings.push_back(rowToBooking(row));
+        }
+        return bookings;
+    });
+}
+
+std::vector<int> BookingRepository::createMany(const std::vector<Booking>& bookings) {
+    if (bookings.empty()) {
+        return {};
+    }
+
+    try {
+        std::vector<int> ids = dbManager.executeTransaction([&](pqxx::work& txn) {
+            std::vector<int> reserved = DatabaseManager::reserveIds(txn, "bookings", bookings.size());
+
+            auto stream = pqxx::stream_to::table(txn, {"bookings"},
+                {"id", "guest_id", "room_id", "check_in_date", "check_out_date", "num_adults",
+                 "num_children", "status", "special_requests", "total_amount"});
+            for (size_t i = 0; i < bookings.size(); i++) {
+                const Booking& booking = bookings[i];
+                stream.write_values(
+                    reserved[i], booking.guestId, booking.roomId, booking.checkInDate.toString(),
+                    booking.checkOutDate.toString(), booking.numAdults, booking.numChildren,
+                    booking.statusToString(), DatabaseManager::nullIfEmpty(booking.specialRequests),
+                    booking.totalAmount
+                );
+            }
+            stream.complete();
+
+            Logger::info("Bookings imported: ", bookings.size());
+            return reserved;
+        });
+
+        if (availabilityIndex) {
+            for (size_t i = 0; i < bookings.size(); i++) {
+                Booking created = bookings[i];
+                created.id = ids[i];
+                availabilityIndex->upsertBooking(created);
+            }
+        }
+        return ids;
+    } catch (const std::exception& e) {
+        Logger::error("BookingRepository::createMany failed: ", e.what());
+        return {};
+    }
+}
+
+size_t BookingRepository::exportAll(const std::function<void(const Booking&)>& visitor) {
+    try {
+        return dbManager.executeReadOnce([&](pqxx::nontransaction& txn) {
+            // Tuple types below follow BOOKING_SCHEMA's column order
+            auto stream = pqxx::stream_from::query(txn, BOOKING_SELECT + "ORDER BY id");
+
+            size_t count = 0;
+            Booking booking;
+            for (const auto& [id, guestId, roomId, checkIn, checkOut, actualCheckIn, actualCheckOut,
+                              numAdults, numChildren, status, specialRequests, totalAmount,
+                              createdAt, updatedAt] :
+                 stream.iter<int, int, int, std::string_view, std::string_view, std::optional<std::string>,
+                             std::optional<std::string>, int, std::optional<int>, std::string,
+                             std::optional<std::string>, std::optional<double>, std::optional<std::string>,
+                             std::optional<std::string>>()) {
+                booking.id = id;
+                booking.guestId = guestId;
+                booking.roomId = roomId;
+                booking.checkInDate = CivilDate::parse(checkIn);
+                booking.checkOutDate = CivilDate::parse(checkOut);
+                booking.actualCheckIn = actualCheckIn.value_or("");
+                booking.actualCheckOut = actualCheckOut.value_or("");
+                booking.numAdults = numAdults;
+                booking.numChildren = numChildren.value_or(0);
+                booking.status = Booking::stringToStatus(status);
+                booking.specialRequests = specialRequests.value_or("");
+                booking.totalAmount = totalAmount.value_or(0.0);
+                booking.createdAt = createdAt.value_or("");
+                booking.updatedAt = updatedAt.value_or("");
+                visitor(booking);
+                count++;
+            }
+            stream.complete();
+            return count;
+        });
+    } catch (const std::exception& e) {
+        Logger::error("BookingRepository::exportAll failed: ", e.what());
+        return 0;
+    }
+}
+
 int BookingRepository::create(const Booking& booking) {
     try {
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "INSERT INTO bookings (guest_id, room_id, check_in_date, check_out_date, "
-                "num_adults, num_children, status, special_requests, total_amount) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9) RETURNING id",
-                booking.guestId, booking.roomId, booking.checkInDate, booking.checkOutDate,
+        int id = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(
+                CREATE,
+                booking.guestId, booking.roomId, booking.checkInDate.toString(), booking.checkOutDate.toString(),
                 booking.numAdults, booking.numChildren, booking.statusToString(),
                 booking.specialRequests, booking.totalAmount
             );
             return result[0][0].as<int>();
         });
+
+        if (availabilityIndex && id > 0) {
+            Booking created = booking;
+            created.id = id;
+            availabilityIndex->upsertBooking(created);
+        }
+        return id;
     } catch (const std::exception& e) {
         Logger::error("BookingRepository::create failed: ", e.what());
         return -1;
@@ -88,13 +337,13 @@ int BookingRepository::create(const Booking& booking) {
 bool BookingRepository::checkIn(int bookingId) {
     try {
         std::string now = DateUtils::getCurrentDateTime();
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "UPDATE bookings SET status = 'checked_in', actual_check_in = $1 WHERE id = $2",
-                now, bookingId
-            );
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(CHECK_IN, now, bookingId);
             return result.affected_rows() > 0;
         });
+
+        bookingCache.invalidate(bookingId);
+        return success;
     } catch (const std::exception& e) {
         return false;
     }
@@ -103,13 +352,17 @@ bool BookingRepository::checkIn(int bookingId) {
 bool BookingRepository::checkOut(int bookingId) {
     try {
         std::string now = DateUtils::getCurrentDateTime();
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "UPDATE bookings SET status = 'checked_out', actual_check_out = $1 WHERE id = $2",
-                now, bookingId
-            );
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(CHECK_OUT, now, bookingId);
             return result.affected_rows() > 0;
         });
+
+        bookingCache.invalidate(bookingId);
+
+        if (availabilityIndex && success) {
+            availabilityIndex->removeBooking(bookingId);
+        }
+        return success;
     } catch (const std::exception& e) {
         return false;
     }
@@ -118,9 +371,29 @@ bool BookingRepository::checkOut(int bookingId) {
 int BookingRepository::getActiveBookingsCount() {
     try {
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec(
-                "SELECT COUNT(*) FROM bookings WHERE status IN ('confirmed', 'checked_in')"
-            );
+            auto result = txn.exec_prepared(COUNT_ACTIVE);
+            return result[0][0].as<int>();
+        });
+    } catch (const std::exception& e) {
+        return 0;
+    }
+}
+
+int BookingRepository::getTodayCheckIns() {
+    try {
+        return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+            auto result = txn.exec_prepared(COUNT_TODAY_CHECK_INS);
+            return result[0][0].as<int>();
+        });
+    } catch (const std::exception& e) {
+        return 0;
+    }
+}
+
+int BookingRepository::getTodayCheckOuts() {
+    try {
+        return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+            auto result = txn.exec_prepared(COUNT_TODAY_CHECK_OUTS);
             return result[0][0].as<int>();
         });
     } catch (const std::exception& e) {
@@ -130,28 +403,107 @@ int BookingRepository::getActiveBookingsCount() {
 
 Booking BookingRepository::rowToBooking(const pqxx::row& row) {
     Booking booking;
-    booking.id = row["id"].as<int>();
-    booking.guestId = row["guest_id"].as<int>();
-    booking.roomId = row["room_id"].as<int>();
-    booking.checkInDate = row["check_in_date"].as<std::string>();
-    booking.checkOutDate = row["check_out_date"].as<std::string>();
-    booking.actualCheckIn = row["actual_check_in"].is_null() ? "" : row["actual_check_in"].as<std::string>();
-    booking.actualCheckOut = row["actual_check_out"].is_null() ? "" : row["actual_check_out"].as<std::string>();
-    booking.numAdults = row["num_adults"].as<int>();
-    booking.numChildren = row["num_children"].as<int>();
-    booking.status = Booking::stringToStatus(row["status"].as<std::string());
-    booking.specialRequests = row["special_requests"].is_null() ? "" : row["special_requests"].as<std::string>();
-    booking.totalAmount = row["total_amount"].is_null() ? 0.0 : row["total_amount"].as<double>();
-    booking.createdAt = row["created_at"].as<std::string>();
-    booking.updatedAt = row["updated_at"].as<std::string>();
+    booking.id = row[COL_ID].as<int>();
+    booking.guestId = row[COL_GUEST_ID].as<int>();
+    booking.roomId = row[COL_ROOM_ID].as<int>();
+    booking.checkInDate = FieldReader::date(row[COL_CHECK_IN_DATE]);
+    booking.checkOutDate = FieldReader::date(row[COL_CHECK_OUT_DATE]);
+    booking.actualCheckIn = FieldReader::text(row[COL_ACTUAL_CHECK_IN]);
+    booking.actualCheckOut = FieldReader::text(row[COL_ACTUAL_CHECK_OUT]);
+    booking.numAdults = row[COL_NUM_ADULTS].as<int>();
+    booking.numChildren = FieldReader::integer(row[COL_NUM_CHILDREN]);
+    booking.status = Booking::stringToStatus(FieldReader::view(row[COL_STATUS]));
+    booking.specialRequests = FieldReader::text(row[COL_SPECIAL_REQUESTS]);
+    booking.totalAmount = FieldReader::number(row[COL_TOTAL_AMOUNT]);
+    booking.createdAt = FieldReader::text(row[COL_CREATED_AT]);
+    booking.updatedAt = FieldReader::text(row[COL_UPDATED_AT]);
     return booking;
 }
 
 std::vector<Booking> BookingRepository::findByGuestId(int guestId) { return {}; }
 std::vector<Booking> BookingRepository::findByRoomId(int roomId) { return {}; }
-bool BookingRepository::update(const Booking& booking) { return false; }
-bool BookingRepository::deleteById(int id) { return false; }
-int BookingRepository::getTodayCheckIns() { return 0; }
-int BookingRepository::getTodayCheckOuts() { return 0; }
+
+bool BookingRepository::update(const Booking& booking) {
+    try {
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(
+                UPDATE,
+                booking.guestId, booking.roomId, booking.checkInDate.toString(), booking.checkOutDate.toString(),
+                booking.numAdults, booking.numChildren, booking.statusToString(),
+                booking.specialRequests, booking.totalAmount, booking.id
+            );
+            return result.affected_rows() > 0;
+        });
+
+        bookingCache.invalidate(booking.id);
+
+        if (availabilityIndex && success) {
+            availabilityIndex->upsertBooking(booking);
+        }
+        return success;
+    } catch (const std::exception& e) {
+        Logger::error("BookingRepository::update failed: ", e.what());
+        return false;
+    }
+}
+
+bool BookingRepository::deleteById(int id) {
+    try {
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(DELETE_BY_ID, id);
+            return result.affected_rows() > 0;
+        });
+
+        bookingCache.invalidate(id);
+
+        if (availabilityIndex && success) {
+            availabilityIndex->removeBooking(id);
+        }
+        return success;
+    } catch (const std::exception& e) {
+        Logger::error("BookingRepository::deleteById failed: ", e.what());
+        return false;
+    }
+}
+
+void BookingRepository::setAvailabilityIndex(AvailabilityIndex* index) {
+    availabilityIndex = index;
+}
+
+// Runs on the notification listener thread. The payload is one changed id
+// or a list of inserted ones; the rows may have been written by another
+// client, so the index takes them from the database.
+void BookingRepository::refreshAvailability(const std::string& payload) {
+    if (!availabilityIndex) return;
+
+    std::optional<std::vector<int>> ids = parseNotificationIds(payload);
+    if (!ids) {
+        availabilityIndex->invalidate();
+        return;
+    }
+
+    try {
+        auto found = dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+            auto result = txn.exec_prepared(FIND_BY_IDS, intArrayLiteral(*ids));
+            std::vector<Booking> bookings;
+            for (const auto& row : result) {
+                bookings.push_back(rowToBooking(row));
+            }
+            return bookings;
+        });
+        for (int id : *ids) {
+            auto booking = std::find_if(found.begin(), found.end(), [id](const Booking& b) { return b.id == id; });
+            if (booking != found.end()) {
+                availabilityIndex->upsertBooking(*booking);
+            } else {
+                availabilityIndex->removeBooking(id);
+            }
+        }
+    } catch (const std::exception& e) {
+        // A stale index could offer a room that is taken; answer from SQL instead
+        Logger::error("BookingRepository::refreshAvailability failed: ", e.what());
+        availabilityIndex->invalidate();
+    }
+}
 
 } // namespace HotelManagement
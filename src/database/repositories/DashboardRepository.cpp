@@ -0,0 +1,62 @@
+#include "database/repositories/DashboardRepository.hpp"
+#include "database/models/Room.hpp"
+#include "utils/Logger.hpp"
+
+namespace HotelManagement {
+
+namespace {
+
+// Query order matches the result indices used in fetchStats()
+enum StatsQuery {
+    ROOM_COUNTS = 0,
+    GUEST_COUNTS,
+    ACTIVE_BOOKINGS,
+    TODAY_CHECK_INS,
+    TODAY_CHECK_OUTS
+};
+
+const std::vector<std::string> STATS_QUERIES = {
+    "SELECT status, COUNT(*) FROM rooms GROUP BY status",
+    "SELECT COUNT(*), COUNT(*) FILTER (WHERE vip_status) FROM guests",
+    "SELECT COUNT(*) FROM bookings WHERE status IN ('confirmed', 'checked_in')",
+    "SELECT COUNT(*) FROM bookings WHERE check_in_date = CURRENT_DATE "
+    "AND status IN ('confirmed', 'checked_in')",
+    "SELECT COUNT(*) FROM bookings WHERE check_out_date = CURRENT_DATE "
+    "AND status = 'checked_in'",
+};
+
+} // namespace
+
+DashboardRepository::DashboardRepository(DatabaseManager& db) : dbManager(db) {}
+
+DashboardStats DashboardRepository::fetchStats() {
+    DashboardStats stats;
+
+    try {
+        auto results = dbManager.executeBatch(STATS_QUERIES);
+
+        for (const auto& row : results[ROOM_COUNTS]) {
+            int count = row[1].as<int>();
+            stats.totalRooms += count;
+
+            switch (Room::stringToStatus(row[0].as<std::string>())) {
+                case RoomStatus::Available:   stats.availableRooms = count; break;
+                case RoomStatus::Occupied:    stats.occupiedRooms = count; break;
+                case RoomStatus::Maintenance: stats.maintenanceRooms = count; break;
+                case RoomStatus::Reserved:    stats.reservedRooms = count; break;
+            }
+        }
+
+        stats.totalGuests = results[GUEST_COUNTS][0][0].as<int>();
+        stats.vipGuests = results[GUEST_COUNTS][0][1].as<int>();
+        stats.activeBookings = results[ACTIVE_BOOKINGS][0][0].as<int>();
+        stats.todayCheckIns = results[TODAY_CHECK_INS][0][0].as<int>();
+        stats.todayCheckOuts = results[TODAY_CHECK_OUTS][0][0].as<int>();
+    } catch (const std::exception& e) {
+        Logger::error("DashboardRepository::fetchStats failed: ", e.what());
+    }
+
+    return stats;
+}
+
+} // namespace HotelManagement
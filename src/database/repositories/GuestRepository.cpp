@@ -1,57 +1,192 @@
 #include "database/repositories/GuestRepository.hpp"
+#include "database/RowMapper.hpp"
 #include "utils/Logger.hpp"
+#include <algorithm>
+#include <unordered_map>
 
 namespace HotelManagement {
 
-GuestRepository::GuestRepository(DatabaseManager& db) : dbManager(db) {}
+namespace {
+
+// Prepared statement names
+constexpr const char* FIND_BY_ID = "guest_find_by_id";
+constexpr const char* FIND_ALL = "guest_find_all";
+constexpr const char* FIRST_PAGE = "guest_first_page";
+constexpr const char* NEXT_PAGE = "guest_next_page";
+constexpr const char* SEARCH_BY_NAME = "guest_search_by_name";
+constexpr const char* FIND_BY_IDS = "guest_find_by_ids";
+constexpr const char* CREATE = "guest_create";
+constexpr const char* UPDATE = "guest_update";
+constexpr const char* DELETE_BY_ID = "guest_delete_by_id";
+constexpr const char* COUNT_ALL = "guest_count_all";
+constexpr const char* COUNT_VIP = "guest_count_vip";
+
+// NOTIFY channels of the guests row-change and insert triggers
+constexpr const char* CHANGED_CHANNEL = "guests_changed";
+constexpr const char* INSERTED_CHANNEL = "guests_inserted";
+
+constexpr TableSchema GUEST_SCHEMA("guests", std::to_array<std::string_view>({
+    "id", "first_name", "last_name", "email", "phone", "address", "id_type", "id_number",
+    "date_of_birth", "nationality", "preferences::text", "vip_status", "created_at", "updated_at"}));
+
+// Select-list positions
+constexpr int COL_ID = GUEST_SCHEMA.column("id");
+constexpr int COL_FIRST_NAME = GUEST_SCHEMA.column("first_name");
+constexpr int COL_LAST_NAME = GUEST_SCHEMA.column("last_name");
+constexpr int COL_EMAIL = GUEST_SCHEMA.column("email");
+constexpr int COL_PHONE = GUEST_SCHEMA.column("phone");
+constexpr int COL_ADDRESS = GUEST_SCHEMA.column("address");
+constexpr int COL_ID_TYPE = GUEST_SCHEMA.column("id_type");
+constexpr int COL_ID_NUMBER = GUEST_SCHEMA.column("id_number");
+constexpr int COL_DATE_OF_BIRTH = GUEST_SCHEMA.column("date_of_birth");
+constexpr int COL_NATIONALITY = GUEST_SCHEMA.column("nationality");
+constexpr int COL_PREFERENCES = GUEST_SCHEMA.column("preferences::text");
+constexpr int COL_VIP_STATUS = GUEST_SCHEMA.column("vip_status");
+constexpr int COL_CREATED_AT = GUEST_SCHEMA.column("created_at");
+constexpr int COL_UPDATED_AT = GUEST_SCHEMA.column("updated_at");
+
+const std::string GUEST_SELECT = GUEST_SCHEMA.selectSql();
+
+const std::string GUEST_ORDER = "ORDER BY last_name, first_name, id";
+
+size_t guestHeapBytes(const Guest& guest) {
+    return heapBytes(guest.firstName) + heapBytes(guest.lastName) + heapBytes(guest.email) +
+           heapBytes(guest.phone) + heapBytes(guest.address) + heapBytes(guest.idType) +
+           heapBytes(guest.idNumber) + heapBytes(guest.dateOfBirth) + heapBytes(guest.nationality) +
+           heapBytes(guest.preferencesJson) + heapBytes(guest.createdAt) + heapBytes(guest.updatedAt);
+}
+
+} // namespace
+
+GuestRepository::GuestRepository(DatabaseManager& db, size_t cacheBytes)
+    : dbManager(db), guestCache(cacheBytes, guestHeapBytes) {
+    dbManager.registerStatements({
+        {FIND_BY_ID, GUEST_SELECT + "WHERE id = $1"},
+        {FIND_ALL, GUEST_SELECT + GUEST_ORDER},
+        {FIRST_PAGE, GUEST_SELECT + GUEST_ORDER + " LIMIT $1"},
+        {NEXT_PAGE, GUEST_SELECT + "WHERE (last_name, first_name, id) > ($1, $2, $3) " +
+                    GUEST_ORDER + " LIMIT $4"},
+        {SEARCH_BY_NAME, GUEST_SELECT + "WHERE first_name ILIKE $1 OR last_name ILIKE $1 " +
+                         GUEST_ORDER + " LIMIT $2"},
+        {FIND_BY_IDS, GUEST_SELECT + "WHERE id = ANY($1::int[])"},
+        {CREATE, "INSERT INTO guests (first_name, last_name, email, phone, address, id_type, "
+                 "id_number, date_of_birth, nationality, vip_status) "
+                 "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10) RETURNING id"},
+        {UPDATE, "UPDATE guests SET first_name=$1, last_name=$2, email=$3, phone=$4, address=$5, "
+                 "id_type=$6, id_number=$7, date_of_birth=$8, nationality=$9, vip_status=$10 WHERE id=$11"},
+        {DELETE_BY_ID, "DELETE FROM guests WHERE id = $1"},
+        {COUNT_ALL, "SELECT COUNT(*) FROM guests"},
+        {COUNT_VIP, "SELECT COUNT(*) FROM guests WHERE vip_status = true"},
+    });
+
+    handlerId = dbManager.addNotificationHandler(CHANGED_CHANNEL, [this](const std::string& payload) {
+        guestCache.applyNotification(payload);
+        refreshSearchEntry(payload);
+    });
+    insertHandlerId = dbManager.addNotificationHandler(INSERTED_CHANNEL, [this](const std::string& payload) {
+        indexInsertedGuests(payload);
+    });
+}
+
+GuestRepository::~GuestRepository() {
+    dbManager.removeNotificationHandler(handlerId);
+    dbManager.removeNotificationHandler(insertHandlerId);
+}
 
 std::optional<Guest> GuestRepository::findById(int id) {
+    return guestCache.getOrLoad(id, [&]() -> std::optional<Guest> {
+        try {
+            return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) -> std::optional<Guest> {
+                auto result = txn.exec_prepared(FIND_BY_ID, id);
+                if (result.empty()) return std::nullopt;
+                return rowToGuest(result[0]);
+            });
+        } catch (const std::exception& e) {
+            Logger::error("GuestRepository::findById failed: ", e.what());
+            return std::nullopt;
+        }
+    });
+}
+
+CacheStats GuestRepository::getCacheStats() const {
+    return guestCache.getStats();
+}
+
+std::vector<Guest> GuestRepository::findAll() {
     try {
-        return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) -> std::optional<Guest> {
-            auto result = txn.exec_params(
-                "SELECT id, first_name, last_name, email, phone, address, id_type, id_number, "
-                "date_of_birth, nationality, preferences::text, vip_status, created_at, updated_at "
-                "FROM guests WHERE id = $1", id
-            );
-            if (result.empty()) return std::nullopt;
-            return rowToGuest(result[0]);
-        });
+        return loadAll();
     } catch (const std::exception& e) {
-        Logger::error("GuestRepository::findById failed: ", e.what());
-        return std::nullopt;
+        Logger::error("GuestRepository::findAll failed: ", e.what());
+        return {};
     }
 }
 
-std::vector<Guest> GuestRepository::findAll() {
+std::vector<Guest> GuestRepository::loadAll() {
+    return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+        auto result = txn.exec_prepared(FIND_ALL);
+        std::vector<Guest> guests;
+        for (const auto& row : result) {
+            guests.push_back(rowToGuest(row));
+        }
+        return guests;
+    });
+}
+
+GuestPage GuestRepository::findPage(const std::optional<GuestKey>& after, size_t limit) {
     try {
+        // Fetch one extra row to learn whether another page follows
+        auto fetchCount = static_cast<int64_t>(limit) + 1;
+
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec(
-                "SELECT id, first_name, last_name, email, phone, address, id_type, id_number, "
-                "date_of_birth, nationality, preferences::text, vip_status, created_at, updated_at "
-                "FROM guests ORDER BY last_name, first_name"
-            );
-            std::vector<Guest> guests;
+            auto result = after.has_value()
+                ? txn.exec_prepared(NEXT_PAGE, after->lastName, after->firstName, after->id, fetchCount)
+                : txn.exec_prepared(FIRST_PAGE, fetchCount);
+
+            GuestPage page;
+            page.items.reserve(std::min(static_cast<size_t>(result.size()), limit));
             for (const auto& row : result) {
-                guests.push_back(rowToGuest(row));
+                if (page.items.size() == limit) {
+                    const Guest& last = page.items.back();
+                    page.nextKey = GuestKey{last.lastName, last.firstName, last.id};
+                    break;
+                }
+                page.items.push_back(rowToGuest(row));
             }
-            return guests;
+            return page;
         });
     } catch (const std::exception& e) {
-        Logger::error("GuestRepository::findAll failed: ", e.what());
+        Logger::error("GuestRepository::findPage failed: ", e.what());
         return {};
     }
 }
 
-std::vector<Guest> GuestRepository::searchByName(const std::string& name) {
+size_t GuestRepository::forEach(const std::function<bool(const Guest&)>& visitor, size_t batchSize) {
+    try {
+        return dbManager.streamQuery(GUEST_SELECT + GUEST_ORDER, batchSize, [&](const pqxx::row& row) {
+            return visitor(rowToGuest(row));
+        });
+    } catch (const std::exception& e) {
+        Logger::error("GuestRepository::forEach failed: ", e.what());
+        return 0;
+    }
+}
+
+std::vector<Guest> GuestRepository::searchByName(const std::string& name, size_t limit) {
+    if (GuestSearchIndex* index = searchIndex.load()) {
+        if (auto matches = index->search(name, limit)) {
+            std::vector<int> ids;
+            ids.reserve(matches->size());
+            for (const auto& match : *matches) {
+                ids.push_back(match.guestId);
+            }
+            return findByIds(ids);
+        }
+    }
+
     try {
         std::string searchPattern = "%" + name + "%";
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec_params(
-                "SELECT id, first_name, last_name, email, phone, address, id_type, id_number, "
-                "date_of_birth, nationality, preferences::text, vip_status, created_at, updated_at "
-                "FROM guests WHERE first_name ILIKE $1 OR last_name ILIKE $1",
-                searchPattern
-            );
+            auto result = txn.exec_prepared(SEARCH_BY_NAME, searchPattern, static_cast<int64_t>(limit));
             std::vector<Guest> guests;
             for (const auto& row : result) {
                 guests.push_back(rowToGuest(row));
@@ -64,18 +199,108 @@ std::vector<Guest> GuestRepository::searchByName(const std::string& name) {
     }
 }
 
+std::vector<int> GuestRepository::createMany(const std::vector<Guest>& guests) {
+    if (guests.empty()) {
+        return {};
+    }
+
+    try {
+        std::vector<int> ids = dbManager.executeTransaction([&](pqxx::work& txn) {
+            std::vector<int> ids = DatabaseManager::reserveIds(txn, "guests", guests.size());
+
+            auto stream = pqxx::stream_to::table(txn, {"guests"},
+                {"id", "first_name", "last_name", "email", "phone", "address", "id_type",
+                 "id_number", "date_of_birth", "nationality", "vip_status"});
+            for (size_t i = 0; i < guests.size(); i++) {
+                const Guest& guest = guests[i];
+                stream.write_values(
+                    ids[i], guest.firstName, guest.lastName, DatabaseManager::nullIfEmpty(guest.email),
+                    guest.phone, DatabaseManager::nullIfEmpty(guest.address), guest.idType, guest.idNumber,
+                    DatabaseManager::nullIfEmpty(guest.dateOfBirth), DatabaseManager::nullIfEmpty(guest.nationality),
+                    guest.vipStatus
+                );
+            }
+            stream.complete();
+
+            Logger::info("Guests imported: ", guests.size());
+            return ids;
+        });
+
+        if (GuestSearchIndex* index = searchIndex.load()) {
+            for (size_t i = 0; i < guests.size(); i++) {
+                Guest created = guests[i];
+                created.id = ids[i];
+                index->upsert(created);
+            }
+        }
+        return ids;
+    } catch (const std::exception& e) {
+        Logger::error("GuestRepository::createMany failed: ", e.what());
+        return {};
+    }
+}
+
+size_t GuestRepository::exportAll(const std::function<void(const Guest&)>& visitor) {
+    try {
+        return streamAll(visitor);
+    } catch (const std::exception& e) {
+        Logger::error("GuestRepository::exportAll failed: ", e.what());
+        return 0;
+    }
+}
+
+size_t GuestRepository::streamAll(const std::function<void(const Guest&)>& visitor) {
+    return dbManager.executeReadOnce([&](pqxx::nontransaction& txn) {
+        // Tuple types below follow GUEST_SCHEMA's column order
+        auto stream = pqxx::stream_from::query(txn, GUEST_SELECT + "ORDER BY id");
+
+        size_t count = 0;
+        Guest guest;
+        for (const auto& [id, firstName, lastName, email, phone, address, idType, idNumber,
+                          dateOfBirth, nationality, preferences, vipStatus, createdAt, updatedAt] :
+             stream.iter<int, std::string, std::string, std::optional<std::string>, std::string,
+                         std::optional<std::string>, std::string, std::string, std::optional<std::string>,
+                         std::optional<std::string>, std::optional<std::string>, std::optional<bool>,
+                         std::optional<std::string>, std::optional<std::string>>()) {
+            guest.id = id;
+            guest.firstName = firstName;
+            guest.lastName = lastName;
+            guest.email = email.value_or("");
+            guest.phone = phone;
+            guest.address = address.value_or("");
+            guest.idType = idType;
+            guest.idNumber = idNumber;
+            guest.dateOfBirth = dateOfBirth.value_or("");
+            guest.nationality = nationality.value_or("");
+            guest.preferencesJson = preferences.value_or("{}");
+            guest.vipStatus = vipStatus.value_or(false);
+            guest.createdAt = createdAt.value_or("");
+            guest.updatedAt = updatedAt.value_or("");
+            visitor(guest);
+            count++;
+        }
+        stream.complete();
+        return count;
+    });
+}
+
 int GuestRepository::create(const Guest& guest) {
     try {
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "INSERT INTO guests (first_name, last_name, email, phone, address, id_type, "
-                "id_number, date_of_birth, nationality, vip_status) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10) RETURNING id",
+        int id = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(
+                CREATE,
                 guest.firstName, guest.lastName, guest.email, guest.phone, guest.address,
                 guest.idType, guest.idNumber, guest.dateOfBirth, guest.nationality, guest.vipStatus
             );
             return result[0][0].as<int>();
         });
+
+        if (GuestSearchIndex* index = searchIndex.load()) {
+            Guest created = guest;
+            created.id = id;
+            index->upsert(created);
+        }
+        return id;
     } catch (const std::exception& e) {
         Logger::error("GuestRepository::create failed: ", e.what());
         return -1;
@@ -84,15 +309,22 @@ int GuestRepository::create(const Guest& guest) {
 
 bool GuestRepository::update(const Guest& guest) {
     try {
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "UPDATE guests SET first_name=$1, last_name=$2, email=$3, phone=$4, address=$5, "
-                "id_type=$6, id_number=$7, date_of_birth=$8, nationality=$9, vip_status=$10 WHERE id=$11",
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(
+                UPDATE,
                 guest.firstName, guest.lastName, guest.email, guest.phone, guest.address,
                 guest.idType, guest.idNumber, guest.dateOfBirth, guest.nationality, guest.vipStatus, guest.id
             );
             return result.affected_rows() > 0;
         });
+
+        // Don't wait for our own NOTIFY to come back
+        guestCache.invalidate(guest.id);
+        GuestSearchIndex* index = searchIndex.load();
+        if (index && success) {
+            index->upsert(guest);
+        }
+        return success;
     } catch (const std::exception& e) {
         Logger::error("GuestRepository::update failed: ", e.what());
         return false;
@@ -101,10 +333,17 @@ bool GuestRepository::update(const Guest& guest) {
 
 bool GuestRepository::deleteById(int id) {
     try {
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params("DELETE FROM guests WHERE id = $1", id);
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(DELETE_BY_ID, id);
             return result.affected_rows() > 0;
         });
+
+        guestCache.invalidate(id);
+        GuestSearchIndex* index = searchIndex.load();
+        if (index && success) {
+            index->remove(id);
+        }
+        return success;
     } catch (const std::exception& e) {
         Logger::error("GuestRepository::deleteById failed: ", e.what());
         return false;
@@ -114,7 +353,7 @@ bool GuestRepository::deleteById(int id) {
 int GuestRepository::getTotalGuests() {
     try {
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec("SELECT COUNT(*) FROM guests");
+            auto result = txn.exec_prepared(COUNT_ALL);
             return result[0][0].as<int>();
         });
     } catch (const std::exception& e) {
@@ -125,7 +364,7 @@ int GuestRepository::getTotalGuests() {
 int GuestRepository::getVIPCount() {
     try {
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec("SELECT COUNT(*) FROM guests WHERE vip_status = true");
+            auto result = txn.exec_prepared(COUNT_VIP);
             return result[0][0].as<int>();
         });
     } catch (const std::exception& e) {
@@ -133,22 +372,124 @@ int GuestRepository::getVIPCount() {
     }
 }
 
+void GuestRepository::setSearchIndex(GuestSearchIndex* index) {
+    searchIndex = index;
+}
+
+bool GuestRepository::rebuildSearchIndex() {
+    GuestSearchIndex* index = searchIndex.load();
+    if (!index) return false;
+
+    try {
+        index->rebuild([&](const GuestSearchIndex::GuestVisitor& add) { streamAll(add); });
+        return true;
+    } catch (const std::exception& e) {
+        Logger::error("GuestRepository::rebuildSearchIndex failed: ", e.what());
+        return false;
+    }
+}
+
+std::vector<Guest> GuestRepository::findByIds(const std::vector<int>& ids) {
+    try {
+        return loadByIds(ids);
+    } catch (const std::exception& e) {
+        Logger::error("GuestRepository::findByIds failed: ", e.what());
+        return {};
+    }
+}
+
+std::vector<Guest> GuestRepository::loadByIds(const std::vector<int>& ids) {
+    if (ids.empty()) {
+        return {};
+    }
+
+    std::vector<Guest> found = dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+        auto result = txn.exec_prepared(FIND_BY_IDS, intArrayLiteral(ids));
+        std::vector<Guest> guests;
+        for (const auto& row : result) {
+            guests.push_back(rowToGuest(row));
+        }
+        return guests;
+    });
+
+    // Back into the order of ids
+    std::unordered_map<int, size_t> rank;
+    for (size_t i = 0; i < ids.size(); i++) {
+        rank.emplace(ids[i], i);
+    }
+    std::sort(found.begin(), found.end(), [&](const Guest& a, const Guest& b) {
+        return rank[a.id] < rank[b.id];
+    });
+    return found;
+}
+
+// Runs on the notification listener thread
+void GuestRepository::refreshSearchEntry(const std::string& payload) {
+    GuestSearchIndex* index = searchIndex.load();
+    if (!index) return;
+
+    std::optional<int> id = parseNotificationId(payload);
+    if (!id) {
+        rebuildSearchIndex();
+        return;
+    }
+
+    try {
+        auto guest = dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) -> std::optional<Guest> {
+            auto result = txn.exec_prepared(FIND_BY_ID, *id);
+            if (result.empty()) return std::nullopt;
+            return rowToGuest(result[0]);
+        });
+        if (guest) {
+            index->upsert(*guest);
+        } else {
+            index->remove(*id);
+        }
+    } catch (const std::exception& e) {
+        Logger::error("GuestRepository::refreshSearchEntry failed: ", e.what());
+    }
+}
+
+// Runs on the notification listener thread. The insert trigger lists the
+// new ids; sequence values commit out of order, so only those ids are safe
+// to index. An empty payload means a bulk load too large to list.
+void GuestRepository::indexInsertedGuests(const std::string& payload) {
+    GuestSearchIndex* index = searchIndex.load();
+    if (!index) return;
+
+    std::optional<std::vector<int>> ids = parseNotificationIds(payload);
+    if (!ids) {
+        rebuildSearchIndex();
+        return;
+    }
+
+    try {
+        for (const Guest& guest : loadByIds(*ids)) {
+            index->upsert(guest);
+        }
+    } catch (const std::exception& e) {
+        // The rows are committed but would stay unsearchable until the next load
+        Logger::error("GuestRepository::indexInsertedGuests failed: ", e.what());
+        rebuildSearchIndex();
+    }
+}
+
 Guest GuestRepository::rowToGuest(const pqxx::row& row) {
     Guest guest;
-    guest.id = row["id"].as<int>();
-    guest.firstName = row["first_name"].as<std::string>();
-    guest.lastName = row["last_name"].as<std::string>();
-    guest.email = row["email"].is_null() ? "" : row["email"].as<std::string>();
-    guest.phone = row["phone"].as<std::string>();
-    guest.address = row["address"].is_null() ? "" : row["address"].as<std::string>();
-    guest.idType = row["id_type"].as<std::string>();
-    guest.idNumber = row["id_number"].as<std::string>();
-    guest.dateOfBirth = row["date_of_birth"].is_null() ? "" : row["date_of_birth"].as<std::string>();
-    guest.nationality = row["nationality"].is_null() ? "" : row["nationality"].as<std::string>();
-    guest.preferencesJson = row["preferences"].is_null() ? "{}" : row["preferences"].as<std::string>();
-    guest.vipStatus = row["vip_status"].as<bool>();
-    guest.createdAt = row["created_at"].as<std::string>();
-    guest.updatedAt = row["updated_at"].as<std::string>();
+    guest.id = row[COL_ID].as<int>();
+    guest.firstName = FieldReader::text(row[COL_FIRST_NAME]);
+    guest.lastName = FieldReader::text(row[COL_LAST_NAME]);
+    guest.email = FieldReader::text(row[COL_EMAIL]);
+    guest.phone = FieldReader::text(row[COL_PHONE]);
+    guest.address = FieldReader::text(row[COL_ADDRESS]);
+    guest.idType = FieldReader::text(row[COL_ID_TYPE]);
+    guest.idNumber = FieldReader::text(row[COL_ID_NUMBER]);
+    guest.dateOfBirth = FieldReader::text(row[COL_DATE_OF_BIRTH]);
+    guest.nationality = FieldReader::text(row[COL_NATIONALITY]);
+    guest.preferencesJson = FieldReader::text(row[COL_PREFERENCES], "{}");
+    guest.vipStatus = FieldReader::boolean(row[COL_VIP_STATUS]);
+    guest.createdAt = FieldReader::text(row[COL_CREATED_AT]);
+    guest.updatedAt = FieldReader::text(row[COL_UPDATED_AT]);
     return guest;
 }
 
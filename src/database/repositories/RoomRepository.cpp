@@ -1,61 +1,252 @@
 #include "database/repositories/RoomRepository.hpp"
+#include "database/RowMapper.hpp"
 #include "utils/Logger.hpp"
 #include <map>
+#include <algorithm>
 
 namespace HotelManagement {
 
-RoomRepository::RoomRepository(DatabaseManager& db) : dbManager(db) {}
+namespace {
+
+// Prepared statement names
+constexpr const char* FIND_BY_ID = "room_find_by_id";
+constexpr const char* FIND_BY_IDS = "room_find_by_ids";
+constexpr const char* FIND_ALL = "room_find_all";
+constexpr const char* FIRST_PAGE = "room_first_page";
+constexpr const char* NEXT_PAGE = "room_next_page";
+constexpr const char* FIND_BY_FLOOR = "room_find_by_floor";
+constexpr const char* FIND_BY_STATUS = "room_find_by_status";
+constexpr const char* FIND_BY_ROOM_TYPE = "room_find_by_room_type";
+constexpr const char* CREATE = "room_create";
+constexpr const char* UPDATE = "room_update";
+constexpr const char* DELETE_BY_ID = "room_delete_by_id";
+constexpr const char* IS_AVAILABLE = "room_is_available";
+constexpr const char* AVAILABLE_IDS = "room_available_ids";
+constexpr const char* AVAILABLE_IDS_FILTERED = "room_available_ids_filtered";
+constexpr const char* UPDATE_STATUS = "room_update_status";
+constexpr const char* COUNT_ALL = "room_count_all";
+constexpr const char* COUNT_BY_STATUS = "room_count_by_status";
+constexpr const char* COUNT_GROUPED_BY_STATUS = "room_count_grouped_by_status";
+constexpr const char* TYPE_FIND_BY_ID = "room_type_find_by_id";
+constexpr const char* TYPE_FIND_BY_IDS = "room_type_find_by_ids";
+constexpr const char* TYPE_FIND_ALL = "room_type_find_all";
+constexpr const char* TYPE_CREATE = "room_type_create";
+constexpr const char* TYPE_UPDATE = "room_type_update";
+
+// NOTIFY channels of the row-change and insert triggers
+constexpr const char* ROOMS_CHANGED_CHANNEL = "rooms_changed";
+constexpr const char* ROOMS_INSERTED_CHANNEL = "rooms_inserted";
+constexpr const char* ROOM_TYPES_CHANGED_CHANNEL = "room_types_changed";
+constexpr const char* ROOM_TYPES_INSERTED_CHANNEL = "room_types_inserted";
+
+constexpr TableSchema ROOM_SCHEMA("rooms", std::to_array<std::string_view>({
+    "id", "room_number", "room_type_id", "floor_number", "status", "notes", "created_at", "updated_at"}));
+
+constexpr int ROOM_COL_ID = ROOM_SCHEMA.column("id");
+constexpr int ROOM_COL_ROOM_NUMBER = ROOM_SCHEMA.column("room_number");
+constexpr int ROOM_COL_ROOM_TYPE_ID = ROOM_SCHEMA.column("room_type_id");
+constexpr int ROOM_COL_FLOOR_NUMBER = ROOM_SCHEMA.column("floor_number");
+constexpr int ROOM_COL_STATUS = ROOM_SCHEMA.column("status");
+constexpr int ROOM_COL_NOTES = ROOM_SCHEMA.column("notes");
+constexpr int ROOM_COL_CREATED_AT = ROOM_SCHEMA.column("created_at");
+constexpr int ROOM_COL_UPDATED_AT = ROOM_SCHEMA.column("updated_at");
+
+constexpr TableSchema ROOM_TYPE_SCHEMA("room_types", std::to_array<std::string_view>({
+    "id", "type_name", "base_price", "max_occupancy", "description", "amenities::text",
+    "created_at", "updated_at"}));
+
+constexpr int TYPE_COL_ID = ROOM_TYPE_SCHEMA.column("id");
+constexpr int TYPE_COL_TYPE_NAME = ROOM_TYPE_SCHEMA.column("type_name");
+constexpr int TYPE_COL_BASE_PRICE = ROOM_TYPE_SCHEMA.column("base_price");
+constexpr int TYPE_COL_MAX_OCCUPANCY = ROOM_TYPE_SCHEMA.column("max_occupancy");
+constexpr int TYPE_COL_DESCRIPTION = ROOM_TYPE_SCHEMA.column("description");
+constexpr int TYPE_COL_AMENITIES = ROOM_TYPE_SCHEMA.column("amenities::text");
+constexpr int TYPE_COL_CREATED_AT = ROOM_TYPE_SCHEMA.column("created_at");
+constexpr int TYPE_COL_UPDATED_AT = ROOM_TYPE_SCHEMA.column("updated_at");
+
+const std::string ROOM_SELECT = ROOM_SCHEMA.selectSql();
+
+const std::string ROOM_ORDER = "ORDER BY floor_number, room_number";
+
+const std::string ROOM_TYPE_SELECT = ROOM_TYPE_SCHEMA.selectSql();
+
+size_t roomHeapBytes(const Room& room) {
+    return heapBytes(room.roomNumber) + heapBytes(room.notes) + heapBytes(room.createdAt) +
+           heapBytes(room.updatedAt);
+}
 
-std::optional<Room> RoomRepository::findById(int id) {
-    try {
-        return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) -> std::optional<Room> {
-            auto result = txn.exec_params(
-                "SELECT id, room_number, room_type_id, floor_number, status, notes, "
-                "created_at, updated_at FROM rooms WHERE id = $1",
-                id
-            );
+size_t roomTypeHeapBytes(const RoomType& roomType) {
+    return heapBytes(roomType.typeName) + heapBytes(roomType.description) +
+           heapBytes(roomType.amenitiesJson) + heapBytes(roomType.createdAt) +
+           heapBytes(roomType.updatedAt);
+}
 
-            if (result.empty()) {
-                return std::nullopt;
-            }
+} // namespace
+
+RoomRepository::RoomRepository(DatabaseManager& db, size_t roomCacheBytes, size_t roomTypeCacheBytes)
+    : dbManager(db),
+      roomCache(roomCacheBytes, roomHeapBytes),
+      roomTypeCache(roomTypeCacheBytes, roomTypeHeapBytes) {
+    dbManager.registerStatements({
+        {FIND_BY_ID, ROOM_SELECT + "WHERE id = $1"},
+        {FIND_BY_IDS, ROOM_SELECT + "WHERE id = ANY($1::int[])"},
+        {FIND_ALL, ROOM_SELECT + ROOM_ORDER},
+        {FIRST_PAGE, ROOM_SELECT + ROOM_ORDER + " LIMIT $1"},
+        {NEXT_PAGE, ROOM_SELECT + "WHERE (floor_number, room_number) > ($1, $2) " +
+                    ROOM_ORDER + " LIMIT $3"},
+        {FIND_BY_FLOOR, ROOM_SELECT + "WHERE floor_number = $1 ORDER BY room_number"},
+        {FIND_BY_STATUS, ROOM_SELECT + "WHERE status = $1 ORDER BY floor_number, room_number"},
+        {FIND_BY_ROOM_TYPE, ROOM_SELECT + "WHERE room_type_id = $1 ORDER BY floor_number, room_number"},
+        {CREATE, "INSERT INTO rooms (room_number, room_type_id, floor_number, status, notes) "
+                 "VALUES ($1, $2, $3, $4, $5) RETURNING id"},
+        {UPDATE, "UPDATE rooms SET room_number = $1, room_type_id = $2, floor_number = $3, "
+                 "status = $4, notes = $5 WHERE id = $6"},
+        {DELETE_BY_ID, "DELETE FROM rooms WHERE id = $1"},
+        {IS_AVAILABLE, "SELECT COUNT(*) FROM bookings "
+                       "WHERE room_id = $1 "
+                       "AND status NOT IN ('cancelled', 'checked_out') "
+                       "AND (check_in_date, check_out_date) OVERLAPS ($2::date, $3::date)"},
+        {AVAILABLE_IDS, "SELECT r.id FROM rooms r "
+                        "WHERE r.status = 'available' "
+                        "AND NOT EXISTS ("
+                        "  SELECT 1 FROM bookings b "
+                        "  WHERE b.room_id = r.id "
+                        "  AND b.status NOT IN ('cancelled', 'checked_out') "
+                        "  AND (b.check_in_date, b.check_out_date) OVERLAPS ($1::date, $2::date)"
+                        ")"},
+        {AVAILABLE_IDS_FILTERED, "SELECT r.id FROM rooms r "
+                                 "JOIN room_types rt ON rt.id = r.room_type_id "
+                                 "WHERE r.status = 'available' "
+                                 "AND ($3 = 0 OR r.room_type_id = $3) "
+                                 "AND rt.max_occupancy >= $4 "
+                                 "AND NOT EXISTS ("
+                                 "  SELECT 1 FROM bookings b "
+                                 "  WHERE b.room_id = r.id "
+                                 "  AND b.status NOT IN ('cancelled', 'checked_out') "
+                                 "  AND (b.check_in_date, b.check_out_date) OVERLAPS ($1::date, $2::date)"
+                                 ") ORDER BY r.id"},
+        {UPDATE_STATUS, "UPDATE rooms SET status = $1 WHERE id = $2"},
+        {COUNT_ALL, "SELECT COUNT(*) FROM rooms"},
+        {COUNT_BY_STATUS, "SELECT COUNT(*) FROM rooms WHERE status = $1"},
+        {COUNT_GROUPED_BY_STATUS, "SELECT status, COUNT(*) FROM rooms GROUP BY status"},
+        {TYPE_FIND_BY_ID, ROOM_TYPE_SELECT + "WHERE id = $1"},
+        {TYPE_FIND_BY_IDS, ROOM_TYPE_SELECT + "WHERE id = ANY($1::int[])"},
+        {TYPE_FIND_ALL, ROOM_TYPE_SELECT + "ORDER BY base_price"},
+        {TYPE_CREATE, "INSERT INTO room_types (type_name, base_price, max_occupancy, description) "
+                      "VALUES ($1, $2, $3, $4) RETURNING id"},
+        {TYPE_UPDATE, "UPDATE room_types SET type_name = $1, base_price = $2, max_occupancy = $3, "
+                      "description = $4 WHERE id = $5"},
+    });
+
+    roomHandlerId = dbManager.addNotificationHandler(ROOMS_CHANGED_CHANNEL, [this](const std::string& payload) {
+        roomCache.applyNotification(payload);
+        refreshAvailability(payload, false);
+    });
+    roomInsertHandlerId = dbManager.addNotificationHandler(ROOMS_INSERTED_CHANNEL,
+                                                           [this](const std::string& payload) {
+        refreshAvailability(payload, false);
+    });
+    roomTypeHandlerId = dbManager.addNotificationHandler(ROOM_TYPES_CHANGED_CHANNEL,
+                                                         [this](const std::string& payload) {
+        roomTypeCache.applyNotification(payload);
+        refreshAvailability(payload, true);
+    });
+    roomTypeInsertHandlerId = dbManager.addNotificationHandler(ROOM_TYPES_INSERTED_CHANNEL,
+                                                               [this](const std::string& payload) {
+        refreshAvailability(payload, true);
+    });
+}
 
-            return rowToRoom(result[0]);
-        });
+RoomRepository::~RoomRepository() {
+    dbManager.removeNotificationHandler(roomHandlerId);
+    dbManager.removeNotificationHandler(roomInsertHandlerId);
+    dbManager.removeNotificationHandler(roomTypeHandlerId);
+    dbManager.removeNotificationHandler(roomTypeInsertHandlerId);
+}
+
+std::optional<Room> RoomRepository::findById(int id) {
+    return roomCache.getOrLoad(id, [&]() -> std::optional<Room> {
+        try {
+            return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) -> std::optional<Room> {
+                auto result = txn.exec_prepared(FIND_BY_ID, id);
+
+                if (result.empty()) {
+                    return std::nullopt;
+                }
+
+                return rowToRoom(result[0]);
+            });
+        } catch (const std::exception& e) {
+            Logger::error("RoomRepository::findById failed: ", e.what());
+            return std::nullopt;
+        }
+    });
+}
+
+std::vector<Room> RoomRepository::findAll() {
+    try {
+        return loadAll();
     } catch (const std::exception& e) {
-        Logger::error("RoomRepository::findById failed: ", e.what());
-        return std::nullopt;
+        Logger::error("RoomRepository::findAll failed: ", e.what());
+        return {};
     }
 }
 
-std::vector<Room> RoomRepository::findAll() {
+std::vector<Room> RoomRepository::loadAll() {
+    return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+        auto result = txn.exec_prepared(FIND_ALL);
+
+        std::vector<Room> rooms;
+        for (const auto& row : result) {
+            rooms.push_back(rowToRoom(row));
+        }
+        return rooms;
+    });
+}
+
+RoomPage RoomRepository::findPage(const std::optional<RoomKey>& after, size_t limit) {
     try {
+        // Fetch one extra row to learn whether another page follows
+        auto fetchCount = static_cast<int64_t>(limit) + 1;
+
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec(
-                "SELECT id, room_number, room_type_id, floor_number, status, notes, "
-                "created_at, updated_at FROM rooms ORDER BY floor_number, room_number"
-            );
+            auto result = after.has_value()
+                ? txn.exec_prepared(NEXT_PAGE, after->floorNumber, after->roomNumber, fetchCount)
+                : txn.exec_prepared(FIRST_PAGE, fetchCount);
 
-            std::vector<Room> rooms;
+            RoomPage page;
+            page.items.reserve(std::min(static_cast<size_t>(result.size()), limit));
             for (const auto& row : result) {
-                rooms.push_back(rowToRoom(row));
+                if (page.items.size() == limit) {
+                    const Room& last = page.items.back();
+                    page.nextKey = RoomKey{last.floorNumber, last.roomNumber};
+                    break;
+                }
+                page.items.push_back(rowToRoom(row));
             }
-            return rooms;
+            return page;
         });
     } catch (const std::exception& e) {
-        Logger::error("RoomRepository::findAll failed: ", e.what());
+        Logger::error("RoomRepository::findPage failed: ", e.what());
         return {};
     }
 }
 
+size_t RoomRepository::forEach(const std::function<bool(const Room&)>& visitor, size_t batchSize) {
+    try {
+        return dbManager.streamQuery(ROOM_SELECT + ROOM_ORDER, batchSize, [&](const pqxx::row& row) {
+            return visitor(rowToRoom(row));
+        });
+    } catch (const std::exception& e) {
+        Logger::error("RoomRepository::forEach failed: ", e.what());
+        return 0;
+    }
+}
+
 std::vector<Room> RoomRepository::findByFloor(int floorNumber) {
     try {
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec_params(
-                "SELECT id, room_number, room_type_id, floor_number, status, notes, "
-                "created_at, updated_at FROM rooms WHERE floor_number = $1 "
-                "ORDER BY room_number",
-                floorNumber
-            );
+            auto result = txn.exec_prepared(FIND_BY_FLOOR, floorNumber);
 
             std::vector<Room> rooms;
             for (const auto& row : result) {
@@ -77,12 +268,7 @@ std::vector<Room> RoomRepository::findByStatus(RoomStatus status) {
         statusStr = temp.statusToString();
 
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec_params(
-                "SELECT id, room_number, room_type_id, floor_number, status, notes, "
-                "created_at, updated_at FROM rooms WHERE status = $1 "
-                "ORDER BY floor_number, room_number",
-                statusStr
-            );
+            auto result = txn.exec_prepared(FIND_BY_STATUS, statusStr);
 
             std::vector<Room> rooms;
             for (const auto& row : result) {
@@ -99,12 +285,7 @@ std::vector<Room> RoomRepository::findByStatus(RoomStatus status) {
 std::vector<Room> RoomRepository::findByRoomType(int roomTypeId) {
     try {
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec_params(
-                "SELECT id, room_number, room_type_id, floor_number, status, notes, "
-                "created_at, updated_at FROM rooms WHERE room_type_id = $1 "
-                "ORDER BY floor_number, room_number",
-                roomTypeId
-            );
+            auto result = txn.exec_prepared(FIND_BY_ROOM_TYPE, roomTypeId);
 
             std::vector<Room> rooms;
             for (const auto& row : result) {
@@ -118,12 +299,78 @@ std::vector<Room> RoomRepository::findByRoomType(int roomTypeId) {
     }
 }
 
+std::vector<int> RoomRepository::createMany(const std::vector<Room>& rooms) {
+    if (rooms.empty()) {
+        return {};
+    }
+
+    try {
+        std::vector<int> ids = dbManager.executeTransaction([&](pqxx::work& txn) {
+            std::vector<int> reserved = DatabaseManager::reserveIds(txn, "rooms", rooms.size());
+
+            auto stream = pqxx::stream_to::table(txn, {"rooms"},
+                {"id", "room_number", "room_type_id", "floor_number", "status", "notes"});
+            for (size_t i = 0; i < rooms.size(); i++) {
+                const Room& room = rooms[i];
+                stream.write_values(reserved[i], room.roomNumber, room.roomTypeId, room.floorNumber,
+                                    room.statusToString(), DatabaseManager::nullIfEmpty(room.notes));
+            }
+            stream.complete();
+
+            Logger::info("Rooms imported: ", rooms.size());
+            return reserved;
+        });
+
+        if (availabilityIndex) {
+            for (size_t i = 0; i < rooms.size(); i++) {
+                Room created = rooms[i];
+                created.id = ids[i];
+                availabilityIndex->upsertRoom(created);
+            }
+        }
+        return ids;
+    } catch (const std::exception& e) {
+        Logger::error("RoomRepository::createMany failed: ", e.what());
+        return {};
+    }
+}
+
+size_t RoomRepository::exportAll(const std::function<void(const Room&)>& visitor) {
+    try {
+        return dbManager.executeReadOnce([&](pqxx::nontransaction& txn) {
+            // Tuple types below follow ROOM_SCHEMA's column order
+            auto stream = pqxx::stream_from::query(txn, ROOM_SELECT + "ORDER BY id");
+
+            size_t count = 0;
+            Room room;
+            for (const auto& [id, roomNumber, roomTypeId, floorNumber, status, notes, createdAt, updatedAt] :
+                 stream.iter<int, std::string, int, int, std::string, std::optional<std::string>,
+                             std::optional<std::string>, std::optional<std::string>>()) {
+                room.id = id;
+                room.roomNumber = roomNumber;
+                room.roomTypeId = roomTypeId;
+                room.floorNumber = floorNumber;
+                room.status = Room::stringToStatus(status);
+                room.notes = notes.value_or("");
+                room.createdAt = createdAt.value_or("");
+                room.updatedAt = updatedAt.value_or("");
+                visitor(room);
+                count++;
+            }
+            stream.complete();
+            return count;
+        });
+    } catch (const std::exception& e) {
+        Logger::error("RoomRepository::exportAll failed: ", e.what());
+        return 0;
+    }
+}
+
 int RoomRepository::create(const Room& room) {
     try {
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "INSERT INTO rooms (room_number, room_type_id, floor_number, status, notes) "
-                "VALUES ($1, $2, $3, $4, $5) RETURNING id",
+        int id = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(
+                CREATE,
                 room.roomNumber,
                 room.roomTypeId,
                 room.floorNumber,
@@ -135,6 +382,13 @@ int RoomRepository::create(const Room& room) {
             Logger::info("Room created: ", room.roomNumber, " (ID: ", newId, ")");
             return newId;
         });
+
+        if (availabilityIndex && id > 0) {
+            Room created = room;
+            created.id = id;
+            availabilityIndex->upsertRoom(created);
+        }
+        return id;
     } catch (const std::exception& e) {
         Logger::error("RoomRepository::create failed: ", e.what());
         return -1;
@@ -143,10 +397,9 @@ int RoomRepository::create(const Room& room) {
 
 bool RoomRepository::update(const Room& room) {
     try {
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "UPDATE rooms SET room_number = $1, room_type_id = $2, floor_number = $3, "
-                "status = $4, notes = $5 WHERE id = $6",
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(
+                UPDATE,
                 room.roomNumber,
                 room.roomTypeId,
                 room.floorNumber,
@@ -161,6 +414,13 @@ bool RoomRepository::update(const Room& room) {
             }
             return success;
         });
+
+        // Don't wait for our own NOTIFY to come back
+        roomCache.invalidate(room.id);
+        if (availabilityIndex && success) {
+            availabilityIndex->upsertRoom(room);
+        }
+        return success;
     } catch (const std::exception& e) {
         Logger::error("RoomRepository::update failed: ", e.what());
         return false;
@@ -169,14 +429,20 @@ bool RoomRepository::update(const Room& room) {
 
 bool RoomRepository::deleteById(int id) {
     try {
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params("DELETE FROM rooms WHERE id = $1", id);
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(DELETE_BY_ID, id);
             bool success = result.affected_rows() > 0;
             if (success) {
                 Logger::info("Room deleted: ID ", id);
             }
             return success;
         });
+
+        roomCache.invalidate(id);
+        if (availabilityIndex && success) {
+            availabilityIndex->removeRoom(id);
+        }
+        return success;
     } catch (const std::exception& e) {
         Logger::error("RoomRepository::deleteById failed: ", e.what());
         return false;
@@ -184,39 +450,129 @@ bool RoomRepository::deleteById(int id) {
 }
 
 bool RoomRepository::isRoomAvailable(int roomId, const std::string& startDate, const std::string& endDate) {
+    if (availabilityIndex) {
+        auto available = availabilityIndex->isRoomAvailable(roomId, startDate, endDate);
+        if (available.has_value()) {
+#ifdef DEBUG
+            if (available.value() != isRoomAvailableInDatabase(roomId, startDate, endDate)) {
+                Logger::warning("AvailabilityIndex disagrees with database for room ", roomId,
+                                " (", startDate, " - ", endDate, ")");
+            }
+#endif
+            return available.value();
+        }
+    }
+    return isRoomAvailableInDatabase(roomId, startDate, endDate);
+}
+
+std::vector<int> RoomRepository::getAvailableRoomIds(const std::string& startDate, const std::string& endDate) {
+    if (availabilityIndex) {
+        auto roomIds = availabilityIndex->getAvailableRoomIds(startDate, endDate);
+        if (roomIds.has_value()) {
+#ifdef DEBUG
+            auto fromDatabase = getAvailableRoomIdsInDatabase(startDate, endDate);
+            std::sort(fromDatabase.begin(), fromDatabase.end());
+            if (fromDatabase != roomIds.value()) {
+                Logger::warning("AvailabilityIndex disagrees with database for ",
+                                startDate, " - ", endDate);
+            }
+#endif
+            return std::move(roomIds.value());
+        }
+    }
+    return getAvailableRoomIdsInDatabase(startDate, endDate);
+}
+
+std::vector<std::vector<int>> RoomRepository::findAvailableRooms(const std::vector<AvailabilityQuery>& queries) {
+    std::vector<std::vector<int>> results(queries.size());
+    std::vector<size_t> unanswered;
+
+    if (availabilityIndex) {
+        auto fromIndex = availabilityIndex->findAvailableRooms(queries);
+        for (size_t i = 0; i < queries.size(); i++) {
+            if (fromIndex[i].has_value()) {
+                results[i] = std::move(fromIndex[i].value());
+            } else {
+                unanswered.push_back(i);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < queries.size(); i++) {
+            unanswered.push_back(i);
+        }
+    }
+
+#ifdef DEBUG
+    if (availabilityIndex && unanswered.size() < queries.size()) {
+        auto fromDatabase = findAvailableRoomsInDatabase(queries);
+        for (size_t i = 0; i < queries.size(); i++) {
+            if (std::find(unanswered.begin(), unanswered.end(), i) == unanswered.end() &&
+                fromDatabase[i] != results[i]) {
+                Logger::warning("AvailabilityIndex disagrees with database for ",
+                                queries[i].startDate, " - ", queries[i].endDate);
+            }
+        }
+    }
+#endif
+
+    if (unanswered.empty()) {
+        return results;
+    }
+
+    // Ranges outside the index window go to the database in one leased connection
+    std::vector<AvailabilityQuery> remaining;
+    remaining.reserve(unanswered.size());
+    for (size_t i : unanswered) {
+        remaining.push_back(queries[i]);
+    }
+    auto fromDatabase = findAvailableRoomsInDatabase(remaining);
+    for (size_t i = 0; i < unanswered.size(); i++) {
+        results[unanswered[i]] = std::move(fromDatabase[i]);
+    }
+    return results;
+}
+
+std::vector<std::vector<int>> RoomRepository::findAvailableRoomsInDatabase(const std::vector<AvailabilityQuery>& queries) {
     try {
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec_params(
-                "SELECT COUNT(*) FROM bookings "
-                "WHERE room_id = $1 "
-                "AND status NOT IN ('cancelled', 'checked_out') "
-                "AND (check_in_date, check_out_date) OVERLAPS ($2::date, $3::date)",
-                roomId, startDate, endDate
-            );
+            std::vector<std::vector<int>> results;
+            results.reserve(queries.size());
+            for (const auto& query : queries) {
+                auto result = txn.exec_prepared(AVAILABLE_IDS_FILTERED, query.startDate, query.endDate,
+                                                query.roomTypeId, query.minOccupancy);
+                std::vector<int> roomIds;
+                roomIds.reserve(result.size());
+                for (const auto& row : result) {
+                    roomIds.push_back(row[0].as<int>());
+                }
+                results.push_back(std::move(roomIds));
+            }
+            return results;
+        });
+    } catch (const std::exception& e) {
+        Logger::error("RoomRepository::findAvailableRoomsInDatabase failed: ", e.what());
+        return std::vector<std::vector<int>>(queries.size());
+    }
+}
+
+bool RoomRepository::isRoomAvailableInDatabase(int roomId, const std::string& startDate, const std::string& endDate) {
+    try {
+        return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+            auto result = txn.exec_prepared(IS_AVAILABLE, roomId, startDate, endDate);
 
             int count = result[0][0].as<int>();
             return count == 0;
         });
     } catch (const std::exception& e) {
-        Logger::error("RoomRepository::isRoomAvailable failed: ", e.what());
+        Logger::error("RoomRepository::isRoomAvailableInDatabase failed: ", e.what());
         return false;
     }
 }
 
-std::vector<int> RoomRepository::getAvailableRoomIds(const std::string& startDate, const std::string& endDate) {
+std::vector<int> RoomRepository::getAvailableRoomIdsInDatabase(const std::string& startDate, const std::string& endDate) {
     try {
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec_params(
-                "SELECT r.id FROM rooms r "
-                "WHERE r.status = 'available' "
-                "AND NOT EXISTS ("
-                "  SELECT 1 FROM bookings b "
-                "  WHERE b.room_id = r.id "
-                "  AND b.status NOT IN ('cancelled', 'checked_out') "
-                "  AND (b.check_in_date, b.check_out_date) OVERLAPS ($1::date, $2::date)"
-                ")",
-                startDate, endDate
-            );
+            auto result = txn.exec_prepared(AVAILABLE_IDS, startDate, endDate);
 
             std::vector<int> availableRooms;
             for (const auto& row : result) {
@@ -225,7 +581,7 @@ std::vector<int> RoomRepository::getAvailableRoomIds(const std::string& startDat
             return availableRooms;
         });
     } catch (const std::exception& e) {
-        Logger::error("RoomRepository::getAvailableRoomIds failed: ", e.what());
+        Logger::error("RoomRepository::getAvailableRoomIdsInDatabase failed: ", e.what());
         return {};
     }
 }
@@ -236,13 +592,16 @@ bool RoomRepository::updateRoomStatus(int roomId, RoomStatus newStatus) {
         temp.status = newStatus;
         std::string statusStr = temp.statusToString();
 
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "UPDATE rooms SET status = $1 WHERE id = $2",
-                statusStr, roomId
-            );
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(UPDATE_STATUS, statusStr, roomId);
             return result.affected_rows() > 0;
         });
+
+        roomCache.invalidate(roomId);
+        if (availabilityIndex && success) {
+            availabilityIndex->updateRoomStatus(roomId, newStatus);
+        }
+        return success;
     } catch (const std::exception& e) {
         Logger::error("RoomRepository::updateRoomStatus failed: ", e.what());
         return false;
@@ -252,7 +611,7 @@ bool RoomRepository::updateRoomStatus(int roomId, RoomStatus newStatus) {
 int RoomRepository::getTotalRooms() {
     try {
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec("SELECT COUNT(*) FROM rooms");
+            auto result = txn.exec_prepared(COUNT_ALL);
             return result[0][0].as<int>();
         });
     } catch (const std::exception& e) {
@@ -268,10 +627,7 @@ int RoomRepository::getRoomsByStatus(RoomStatus status) {
         std::string statusStr = temp.statusToString();
 
         return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec_params(
-                "SELECT COUNT(*) FROM rooms WHERE status = $1",
-                statusStr
-            );
+            auto result = txn.exec_prepared(COUNT_BY_STATUS, statusStr);
             return result[0][0].as<int>();
         });
     } catch (const std::exception& e) {
@@ -282,61 +638,72 @@ int RoomRepository::getRoomsByStatus(RoomStatus status) {
 
 std::map<RoomStatus, int> RoomRepository::getRoomCountByStatus() {
     std::map<RoomStatus, int> counts;
-    counts[RoomStatus::Available] = getRoomsByStatus(RoomStatus::Available);
-    counts[RoomStatus::Occupied] = getRoomsByStatus(RoomStatus::Occupied);
-    counts[RoomStatus::Maintenance] = getRoomsByStatus(RoomStatus::Maintenance);
-    counts[RoomStatus::Reserved] = getRoomsByStatus(RoomStatus::Reserved);
-    return counts;
-}
+    counts[RoomStatus::Available] = 0;
+    counts[RoomStatus::Occupied] = 0;
+    counts[RoomStatus::Maintenance] = 0;
+    counts[RoomStatus::Reserved] = 0;
 
-// Room Type operations
-std::optional<RoomType> RoomRepository::findRoomTypeById(int id) {
     try {
-        return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) -> std::optional<RoomType> {
-            auto result = txn.exec_params(
-                "SELECT id, type_name, base_price, max_occupancy, description, "
-                "amenities::text, created_at, updated_at FROM room_types WHERE id = $1",
-                id
-            );
-
-            if (result.empty()) {
-                return std::nullopt;
+        dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+            // One grouped query instead of a round trip per status
+            auto result = txn.exec_prepared(COUNT_GROUPED_BY_STATUS);
+            for (const auto& row : result) {
+                counts[Room::stringToStatus(row[0].as<std::string>())] = row[1].as<int>();
             }
-
-            return rowToRoomType(result[0]);
+            return true;
         });
     } catch (const std::exception& e) {
-        Logger::error("RoomRepository::findRoomTypeById failed: ", e.what());
-        return std::nullopt;
+        Logger::error("RoomRepository::getRoomCountByStatus failed: ", e.what());
     }
+    return counts;
+}
+
+// Room Type operations
+std::optional<RoomType> RoomRepository::findRoomTypeById(int id) {
+    return roomTypeCache.getOrLoad(id, [&]() -> std::optional<RoomType> {
+        try {
+            return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) -> std::optional<RoomType> {
+                auto result = txn.exec_prepared(TYPE_FIND_BY_ID, id);
+
+                if (result.empty()) {
+                    return std::nullopt;
+                }
+
+                return rowToRoomType(result[0]);
+            });
+        } catch (const std::exception& e) {
+            Logger::error("RoomRepository::findRoomTypeById failed: ", e.what());
+            return std::nullopt;
+        }
+    });
 }
 
 std::vector<RoomType> RoomRepository::findAllRoomTypes() {
     try {
-        return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
-            auto result = txn.exec(
-                "SELECT id, type_name, base_price, max_occupancy, description, "
-                "amenities::text, created_at, updated_at FROM room_types ORDER BY base_price"
-            );
-
-            std::vector<RoomType> roomTypes;
-            for (const auto& row : result) {
-                roomTypes.push_back(rowToRoomType(row));
-            }
-            return roomTypes;
-        });
+        return loadAllRoomTypes();
     } catch (const std::exception& e) {
         Logger::error("RoomRepository::findAllRoomTypes failed: ", e.what());
         return {};
     }
 }
 
+std::vector<RoomType> RoomRepository::loadAllRoomTypes() {
+    return dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+        auto result = txn.exec_prepared(TYPE_FIND_ALL);
+
+        std::vector<RoomType> roomTypes;
+        for (const auto& row : result) {
+            roomTypes.push_back(rowToRoomType(row));
+        }
+        return roomTypes;
+    });
+}
+
 int RoomRepository::createRoomType(const RoomType& roomType) {
     try {
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "INSERT INTO room_types (type_name, base_price, max_occupancy, description) "
-                "VALUES ($1, $2, $3, $4) RETURNING id",
+        int id = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(
+                TYPE_CREATE,
                 roomType.typeName,
                 roomType.basePrice,
                 roomType.maxOccupancy,
@@ -345,6 +712,13 @@ int RoomRepository::createRoomType(const RoomType& roomType) {
 
             return result[0][0].as<int>();
         });
+
+        if (availabilityIndex && id > 0) {
+            RoomType created = roomType;
+            created.id = id;
+            availabilityIndex->upsertRoomType(created);
+        }
+        return id;
     } catch (const std::exception& e) {
         Logger::error("RoomRepository::createRoomType failed: ", e.what());
         return -1;
@@ -353,10 +727,9 @@ int RoomRepository::createRoomType(const RoomType& roomType) {
 
 bool RoomRepository::updateRoomType(const RoomType& roomType) {
     try {
-        return dbManager.executeTransaction([&](pqxx::work& txn) {
-            auto result = txn.exec_params(
-                "UPDATE room_types SET type_name = $1, base_price = $2, max_occupancy = $3, "
-                "description = $4 WHERE id = $5",
+        bool success = dbManager.executeTransaction([&](pqxx::work& txn) {
+            auto result = txn.exec_prepared(
+                TYPE_UPDATE,
                 roomType.typeName,
                 roomType.basePrice,
                 roomType.maxOccupancy,
@@ -366,36 +739,115 @@ bool RoomRepository::updateRoomType(const RoomType& roomType) {
 
             return result.affected_rows() > 0;
         });
+
+        roomTypeCache.invalidate(roomType.id);
+        if (availabilityIndex && success) {
+            availabilityIndex->upsertRoomType(roomType);
+        }
+        return success;
     } catch (const std::exception& e) {
         Logger::error("RoomRepository::updateRoomType failed: ", e.what());
         return false;
     }
 }
 
+void RoomRepository::setAvailabilityIndex(AvailabilityIndex* index) {
+    availabilityIndex = index;
+}
+
+// Runs on the notification listener thread. The payload is one changed id
+// or a list of inserted ones; the rows may have been written by another
+// client, so the index takes them from the database.
+void RoomRepository::refreshAvailability(const std::string& payload, bool roomTypes) {
+    if (!availabilityIndex) return;
+
+    std::optional<std::vector<int>> ids = parseNotificationIds(payload);
+    if (!ids) {
+        availabilityIndex->invalidate();
+        return;
+    }
+
+    try {
+        if (roomTypes) {
+            auto found = dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+                auto result = txn.exec_prepared(TYPE_FIND_BY_IDS, intArrayLiteral(*ids));
+                std::vector<RoomType> types;
+                for (const auto& row : result) {
+                    types.push_back(rowToRoomType(row));
+                }
+                return types;
+            });
+            // A room type cannot be deleted while rooms still use it
+            for (const auto& roomType : found) {
+                availabilityIndex->upsertRoomType(roomType);
+            }
+            return;
+        }
+
+        auto found = dbManager.executeReadTransaction([&](pqxx::nontransaction& txn) {
+            auto result = txn.exec_prepared(FIND_BY_IDS, intArrayLiteral(*ids));
+            std::vector<Room> rooms;
+            for (const auto& row : result) {
+                rooms.push_back(rowToRoom(row));
+            }
+            return rooms;
+        });
+        for (int id : *ids) {
+            auto room = std::find_if(found.begin(), found.end(), [id](const Room& r) { return r.id == id; });
+            if (room != found.end()) {
+                availabilityIndex->upsertRoom(*room);
+            } else {
+                availabilityIndex->removeRoom(id);
+            }
+        }
+    } catch (const std::exception& e) {
+        // A stale index could offer a room that is gone or out of service
+        Logger::error("RoomRepository::refreshAvailability failed: ", e.what());
+        availabilityIndex->invalidate();
+    }
+}
+
+void RoomRepository::primeCaches(const std::vector<Room>& rooms, const std::vector<RoomType>& roomTypes) {
+    for (const auto& room : rooms) {
+        roomCache.prime(room.id, room);
+    }
+    for (const auto& roomType : roomTypes) {
+        roomTypeCache.prime(roomType.id, roomType);
+    }
+}
+
+CacheStats RoomRepository::getRoomCacheStats() const {
+    return roomCache.getStats();
+}
+
+CacheStats RoomRepository::getRoomTypeCacheStats() const {
+    return roomTypeCache.getStats();
+}
+
 // Helper methods
 Room RoomRepository::rowToRoom(const pqxx::row& row) {
     Room room;
-    room.id = row["id"].as<int>();
-    room.roomNumber = row["room_number"].as<std::string>();
-    room.roomTypeId = row["room_type_id"].as<int>();
-    room.floorNumber = row["floor_number"].as<int>();
-    room.status = Room::stringToStatus(row["status"].as<std::string>());
-    room.notes = row["notes"].is_null() ? "" : row["notes"].as<std::string>();
-    room.createdAt = row["created_at"].as<std::string>();
-    room.updatedAt = row["updated_at"].as<std::string>();
+    room.id = row[ROOM_COL_ID].as<int>();
+    room.roomNumber = FieldReader::text(row[ROOM_COL_ROOM_NUMBER]);
+    room.roomTypeId = row[ROOM_COL_ROOM_TYPE_ID].as<int>();
+    room.floorNumber = row[ROOM_COL_FLOOR_NUMBER].as<int>();
+    room.status = Room::stringToStatus(FieldReader::view(row[ROOM_COL_STATUS]));
+    room.notes = FieldReader::text(row[ROOM_COL_NOTES]);
+    room.createdAt = FieldReader::text(row[ROOM_COL_CREATED_AT]);
+    room.updatedAt = FieldReader::text(row[ROOM_COL_UPDATED_AT]);
     return room;
 }
 
 RoomType RoomRepository::rowToRoomType(const pqxx::row& row) {
     RoomType roomType;
-    roomType.id = row["id"].as<int>();
-    roomType.typeName = row["type_name"].as<std::string>();
-    roomType.basePrice = row["base_price"].as<double>();
-    roomType.maxOccupancy = row["max_occupancy"].as<int>();
-    roomType.description = row["description"].is_null() ? "" : row["description"].as<std::string>();
-    roomType.amenitiesJson = row["amenities"].is_null() ? "{}" : row["amenities"].as<std::string>();
-    roomType.createdAt = row["created_at"].as<std::string>();
-    roomType.updatedAt = row["updated_at"].as<std::string>();
+    roomType.id = row[TYPE_COL_ID].as<int>();
+    roomType.typeName = FieldReader::text(row[TYPE_COL_TYPE_NAME]);
+    roomType.basePrice = row[TYPE_COL_BASE_PRICE].as<double>();
+    roomType.maxOccupancy = row[TYPE_COL_MAX_OCCUPANCY].as<int>();
+    roomType.description = FieldReader::text(row[TYPE_COL_DESCRIPTION]);
+    roomType.amenitiesJson = FieldReader::text(row[TYPE_COL_AMENITIES], "{}");
+    roomType.createdAt = FieldReader::text(row[TYPE_COL_CREATED_AT]);
+    roomType.updatedAt = FieldReader::text(row[TYPE_COL_UPDATED_AT]);
     return roomType;
 }
 
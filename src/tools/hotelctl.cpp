@@ -0,0 +1,273 @@
+// Headless batch tasks for night jobs and scripted maintenance. Needs only
+// the database: no window, no in-memory indexes, no NOTIFY listener.
+//
+//   hotelctl [--config FILE] import <guests|rooms|bookings> <file.csv> [--batch N] [--threads N]
+//   hotelctl [--config FILE] export <guests|rooms|bookings> <file.csv>
+//   hotelctl [--config FILE] night-audit [--date YYYY-MM-DD [--cancel-no-shows]]
+//   hotelctl [--config FILE] report summary
+//   hotelctl [--config FILE] report occupancy --from YYYY-MM-DD --to YYYY-MM-DD [--csv FILE]
+//
+// The audit date defaults to today; cancelling no-shows needs an explicit
+// --date so a rerun can never cancel the wrong day. Occupancy covers the
+// nights [from, to).
+// Exit status is 0 on success, 1 on failure and 2 on bad usage.
+
+#include "core/Config.hpp"
+#include "core/NightAudit.hpp"
+#include "core/TableTransfer.hpp"
+#include "database/DatabaseManager.hpp"
+#include "database/repositories/BookingRepository.hpp"
+#include "database/repositories/DashboardRepository.hpp"
+#include "database/repositories/RoomRepository.hpp"
+#include "utils/Csv.hpp"
+#include "utils/DateUtils.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace HotelManagement;
+
+namespace {
+
+// One-shot jobs read each row once; entity caches would only cost startup
+constexpr size_t NO_CACHE = 0;
+
+struct Options {
+    std::string configFile = "config/database.ini";
+    size_t batchSize = 10000;
+    size_t threads = 0;
+    std::string date;
+    std::string from;
+    std::string to;
+    std::string csvFile;
+    bool cancelNoShows = false;
+    std::vector<std::string> command;
+};
+
+int usage() {
+    std::cerr << "Usage: hotelctl [--config FILE] import <guests|rooms|bookings> <file.csv> [--batch N] [--threads N]\n"
+              << "       hotelctl [--config FILE] export <guests|rooms|bookings> <file.csv>\n"
+              << "       hotelctl [--config FILE] night-audit [--date YYYY-MM-DD [--cancel-no-shows]]\n"
+              << "       hotelctl [--config FILE] report summary\n"
+              << "       hotelctl [--config FILE] report occupancy --from YYYY-MM-DD --to YYYY-MM-DD [--csv FILE]\n";
+    return 2;
+}
+
+std::optional<Options> parseArgs(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--config" && hasValue) {
+            options.configFile = argv[++i];
+        } else if (arg == "--batch" && hasValue) {
+            options.batchSize = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--date" && hasValue) {
+            options.date = argv[++i];
+        } else if (arg == "--from" && hasValue) {
+            options.from = argv[++i];
+        } else if (arg == "--to" && hasValue) {
+            options.to = argv[++i];
+        } else if (arg == "--csv" && hasValue) {
+            options.csvFile = argv[++i];
+        } else if (arg == "--cancel-no-shows") {
+            options.cancelNoShows = true;
+        } else if (arg.rfind("--", 0) == 0) {
+            return std::nullopt;
+        } else {
+            options.command.push_back(arg);
+        }
+    }
+    if (options.command.empty()) {
+        return std::nullopt;
+    }
+    return options;
+}
+
+// Check the command shape before connecting, so usage errors are instant
+bool isValidCommand(const Options& options) {
+    const std::vector<std::string>& command = options.command;
+    const std::string& name = command[0];
+    if (name == "import" || name == "export") {
+        return command.size() == 3 && TableTransfer::isTransferTable(command[1]);
+    }
+    if (name == "night-audit") {
+        if (options.date.empty()) {
+            return command.size() == 1 && !options.cancelNoShows;
+        }
+        return command.size() == 1 && CivilDate::parse(options.date).isValid();
+    }
+    if (name == "report" && command.size() == 2) {
+        if (command[1] == "summary") {
+            return true;
+        }
+        if (command[1] == "occupancy") {
+            CivilDate from = CivilDate::parse(options.from);
+            CivilDate to = CivilDate::parse(options.to);
+            return from.isValid() && to.isValid() && from < to;
+        }
+    }
+    return false;
+}
+
+std::string money(double amount) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.2f", amount);
+    return text;
+}
+
+std::string percent(double rate) {
+    char text[16];
+    std::snprintf(text, sizeof(text), "%.1f%%", rate * 100.0);
+    return text;
+}
+
+void printBookings(const char* title, const std::vector<Booking>& bookings) {
+    if (bookings.empty()) {
+        return;
+    }
+    std::cout << title << ":\n";
+    for (const Booking& booking : bookings) {
+        std::cout << "  #" << booking.id << "  guest " << booking.guestId << "  room " << booking.roomId << "  "
+                  << booking.checkInDate.toString() << " to " << booking.checkOutDate.toString() << "  "
+                  << booking.statusToString() << "\n";
+    }
+}
+
+void printRooms(const char* title, const std::vector<int>& roomIds) {
+    if (roomIds.empty()) {
+        return;
+    }
+    std::cout << title << ":";
+    for (int roomId : roomIds) {
+        std::cout << " " << roomId;
+    }
+    std::cout << "\n";
+}
+
+int runNightAudit(const Options& options, DatabaseManager& db) {
+    CivilDate date = options.date.empty() ? DateUtils::getToday() : CivilDate::parse(options.date);
+
+    BookingRepository bookings(db, NO_CACHE);
+    RoomRepository rooms(db, NO_CACHE, NO_CACHE);
+    NightAuditReport report = NightAudit::run(bookings, rooms, date, options.cancelNoShows);
+
+    std::cout << "Night audit for " << date.toString() << "\n"
+              << "  Rooms occupied: " << report.roomsOccupied << " of " << report.totalRooms
+              << " (" << percent(report.getOccupancyRate()) << ")\n"
+              << "  Arrivals: " << report.arrivals << "  Departures: " << report.departures << "\n"
+              << "  Room revenue: " << money(report.roomRevenue) << "\n";
+    printBookings("No-shows", report.noShows);
+    if (options.cancelNoShows) {
+        std::cout << "  Cancelled " << report.noShowsCancelled << " of " << report.noShows.size() << " no-shows\n";
+    }
+    printBookings("Overdue departures", report.overdueDepartures);
+    printRooms("Rooms marked occupied with nobody checked in", report.occupiedWithoutStay);
+    printRooms("Rooms with a guest checked in but not marked occupied", report.stayInFreeRoom);
+
+    bool allCancelled = !options.cancelNoShows || report.noShowsCancelled == report.noShows.size();
+    return allCancelled ? 0 : 1;
+}
+
+int runSummary(DatabaseManager& db) {
+    DashboardRepository dashboard(db);
+    DashboardStats stats = dashboard.fetchStats();
+
+    std::cout << "Rooms: " << stats.totalRooms << " (" << stats.availableRooms << " available, "
+              << stats.occupiedRooms << " occupied, " << stats.reservedRooms << " reserved, "
+              << stats.maintenanceRooms << " in maintenance)\n"
+              << "Occupancy: " << percent(stats.getOccupancyRate()) << "\n"
+              << "Guests: " << stats.totalGuests << " (" << stats.vipGuests << " VIP)\n"
+              << "Active bookings: " << stats.activeBookings << "\n"
+              << "Today: " << stats.todayCheckIns << " check-ins, " << stats.todayCheckOuts << " check-outs\n";
+    return 0;
+}
+
+int runOccupancy(const Options& options, DatabaseManager& db) {
+    BookingRepository bookings(db, NO_CACHE);
+    RoomRepository rooms(db, NO_CACHE, NO_CACHE);
+    int totalRooms = rooms.getTotalRooms();
+    std::vector<OccupancyDay> days =
+        NightAudit::occupancy(bookings, CivilDate::parse(options.from), CivilDate::parse(options.to));
+
+    std::ofstream file;
+    if (!options.csvFile.empty()) {
+        file.open(options.csvFile, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "Cannot open " << options.csvFile << "\n";
+            return 1;
+        }
+    }
+    CsvWriter writer(options.csvFile.empty() ? std::cout : file);
+    writer.writeRow({"date", "rooms_sold", "total_rooms", "occupancy", "room_revenue"});
+    for (const OccupancyDay& day : days) {
+        double rate = totalRooms > 0 ? static_cast<double>(day.roomsSold) / totalRooms : 0.0;
+        writer.writeRow({day.date.toString(), std::to_string(day.roomsSold), std::to_string(totalRooms),
+                         percent(rate), money(day.roomRevenue)});
+    }
+    return options.csvFile.empty() || file ? 0 : 1;
+}
+
+int runCommand(const Options& options, DatabaseManager& db) {
+    const std::vector<std::string>& command = options.command;
+    if (command[0] == "import") {
+        ImportOptions importOptions;
+        importOptions.batchSize = options.batchSize;
+        importOptions.threads = options.threads;
+        return TableTransfer::importCsv(db, command[1], command[2], importOptions, std::cout, std::cerr) ? 0 : 1;
+    }
+    if (command[0] == "export") {
+        return TableTransfer::exportCsv(db, command[1], command[2], std::cout, std::cerr) ? 0 : 1;
+    }
+    if (command[0] == "night-audit") {
+        return runNightAudit(options, db);
+    }
+    return command[1] == "summary" ? runSummary(db) : runOccupancy(options, db);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    auto options = parseArgs(argc, argv);
+    if (!options.has_value() || !isValidCommand(*options)) {
+        return usage();
+    }
+
+    Logger::init("hotelctl.log");
+    Logger::setLevel(LogLevel::INFO);
+
+    Config config;
+    if (!config.load(options->configFile)) {
+        std::cerr << "Could not load " << options->configFile << "\n";
+        return 1;
+    }
+
+    // One connection: every task here runs its queries one after another
+    DatabaseManager db(config.buildConnectionString(), 1,
+                       std::chrono::seconds(std::max(1, config.getConnectionTimeout())));
+    if (!db.connect()) {
+        std::cerr << "Database connection failed: " << db.getLastError() << "\n";
+        return 1;
+    }
+
+    int status = 1;
+    try {
+        status = runCommand(*options, db);
+    } catch (const std::exception& e) {
+        Logger::error("hotelctl failed: ", e.what());
+        std::cerr << "Failed: " << e.what() << "\n";
+    }
+
+    db.disconnect();
+    Logger::shutdown();
+    return status;
+}
@@ -0,0 +1,361 @@
+#include "utils/CompletionIndex.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace HotelManagement {
+
+namespace {
+
+constexpr uint32_t NO_TERM = std::numeric_limits<uint32_t>::max();
+constexpr uint32_t NO_POSITION = std::numeric_limits<uint32_t>::max();
+
+// Sorted terms per blockMax entry
+constexpr size_t BLOCK_SIZE = 64;
+
+// New terms kept aside before they are merged into the sorted array
+constexpr size_t MAX_RECENT = 1024;
+
+// Power of two
+constexpr size_t MIN_BUCKETS = 1024;
+
+// Trimmed, with whitespace runs collapsed to one space
+std::string tidy(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    bool pendingSpace = false;
+    for (char c : text) {
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            pendingSpace = !out.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            out.push_back(' ');
+            pendingSpace = false;
+        }
+        out.push_back(c);
+    }
+    if (out.size() > std::numeric_limits<uint16_t>::max()) {
+        out.resize(std::numeric_limits<uint16_t>::max());
+    }
+    return out;
+}
+
+// ASCII only, so keys keep the byte length of their display text
+std::string lowercase(std::string_view text) {
+    std::string out(text);
+    for (char& c : out) {
+        if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+    }
+    return out;
+}
+
+bool startsWith(std::string_view text, std::string_view prefix) {
+    return text.substr(0, prefix.size()) == prefix;
+}
+
+// FNV-1a
+size_t hashOf(std::string_view key) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : key) {
+        hash = (hash ^ c) * 1099511628211ull;
+    }
+    return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+} // namespace
+
+CompletionIndex::CompletionIndex(size_t termsPerOwner)
+    : termsPerOwner(std::max<size_t>(1, termsPerOwner)) {}
+
+void CompletionIndex::assign(int ownerId, std::initializer_list<std::string_view> newTerms) {
+    if (ownerId <= 0) return;
+
+    size_t first = static_cast<size_t>(ownerId) * termsPerOwner;
+    if (ownerTerms.size() < first + termsPerOwner) {
+        ownerTerms.resize(first + termsPerOwner, NO_TERM);
+    }
+    uint32_t* owned = ownerTerms.data() + first;
+
+    for (size_t i = 0; i < termsPerOwner; i++) {
+        if (owned[i] != NO_TERM) {
+            dropWeight(owned[i]);
+            owned[i] = NO_TERM;
+        }
+    }
+
+    size_t count = 0;
+    for (std::string_view term : newTerms) {
+        if (count == termsPerOwner) break;
+        std::string display = tidy(term);
+        if (display.empty()) continue;
+
+        uint32_t termId = findOrAdd(display, lowercase(display));
+        // An owner counts once per term ("Lee Lee")
+        if (std::find(owned, owned + count, termId) != owned + count) continue;
+        addWeight(termId);
+        owned[count++] = termId;
+    }
+
+    if (recent.size() >= MAX_RECENT) {
+        merge();
+    }
+}
+
+void CompletionIndex::remove(int ownerId) {
+    if (ownerId <= 0) return;
+
+    size_t first = static_cast<size_t>(ownerId) * termsPerOwner;
+    if (ownerTerms.size() < first + termsPerOwner) return;
+
+    for (size_t i = first; i < first + termsPerOwner; i++) {
+        if (ownerTerms[i] != NO_TERM) {
+            dropWeight(ownerTerms[i]);
+            ownerTerms[i] = NO_TERM;
+        }
+    }
+}
+
+void CompletionIndex::clear() {
+    *this = CompletionIndex(termsPerOwner);
+}
+
+std::vector<Completion> CompletionIndex::complete(std::string_view prefix, size_t limit) const {
+    std::string key = lowercase(tidy(prefix));
+    if (key.empty() || limit == 0) {
+        return {};
+    }
+
+    // Keep the best `limit` terms in a heap whose top is the worst kept
+    struct Candidate {
+        uint32_t weight;
+        uint32_t termId;
+    };
+    auto better = [this](const Candidate& a, const Candidate& b) {
+        if (a.weight != b.weight) return a.weight > b.weight;
+        return keyOf(a.termId) < keyOf(b.termId);
+    };
+    std::vector<Candidate> best;
+    auto offer = [&](const Candidate& candidate) {
+        if (best.size() < limit) {
+            best.push_back(candidate);
+            std::push_heap(best.begin(), best.end(), better);
+        } else if (better(candidate, best.front())) {
+            std::pop_heap(best.begin(), best.end(), better);
+            best.back() = candidate;
+            std::push_heap(best.begin(), best.end(), better);
+        }
+    };
+
+    size_t begin = lowerBound(key);
+    size_t end = static_cast<size_t>(std::partition_point(sorted.begin() + begin, sorted.end(), [&](uint32_t termId) {
+        return startsWith(keyOf(termId), key);
+    }) - sorted.begin());
+
+    // Sorted terms are visited in key order, so a block whose heaviest term
+    // only ties the worst kept one has nothing better to offer
+    for (size_t block = begin / BLOCK_SIZE; block * BLOCK_SIZE < end; block++) {
+        if (best.size() == limit && blockMax[block] <= best.front().weight) continue;
+
+        size_t from = std::max(begin, block * BLOCK_SIZE);
+        size_t until = std::min(end, (block + 1) * BLOCK_SIZE);
+        for (size_t i = from; i < until; i++) {
+            if (sortedWeights[i] > 0) {
+                offer({sortedWeights[i], sorted[i]});
+            }
+        }
+    }
+
+    auto recentBegin = std::lower_bound(recent.begin(), recent.end(), std::string_view(key),
+                                        [this](uint32_t termId, std::string_view value) {
+        return keyOf(termId) < value;
+    });
+    for (auto it = recentBegin; it != recent.end() && startsWith(keyOf(*it), key); ++it) {
+        if (weights[*it] > 0) {
+            offer({weights[*it], *it});
+        }
+    }
+
+    std::sort(best.begin(), best.end(), better);
+    std::vector<Completion> completions;
+    completions.reserve(best.size());
+    for (const Candidate& candidate : best) {
+        const Term& term = terms[candidate.termId];
+        completions.push_back({displays.substr(term.offset, term.length), candidate.weight});
+    }
+    return completions;
+}
+
+std::string_view CompletionIndex::keyOf(uint32_t termId) const {
+    const Term& term = terms[termId];
+    return std::string_view(keys).substr(term.offset, term.length);
+}
+
+size_t CompletionIndex::lowerBound(std::string_view key) const {
+    return static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), key,
+                                                [this](uint32_t termId, std::string_view value) {
+        return keyOf(termId) < value;
+    }) - sorted.begin());
+}
+
+uint32_t CompletionIndex::findOrAdd(std::string_view display, std::string_view key) {
+    if (buckets.empty()) {
+        rehash(MIN_BUCKETS);
+    }
+
+    size_t mask = buckets.size() - 1;
+    size_t bucket = hashOf(key) & mask;
+    while (buckets[bucket] != NO_TERM) {
+        if (keyOf(buckets[bucket]) == key) {
+            return buckets[bucket];
+        }
+        bucket = (bucket + 1) & mask;
+    }
+
+    uint32_t termId = static_cast<uint32_t>(terms.size());
+    terms.push_back({static_cast<uint32_t>(keys.size()), static_cast<uint16_t>(key.size())});
+    keys.append(key);
+    displays.append(display);
+    weights.push_back(0);
+    positions.push_back(NO_POSITION);
+    buckets[bucket] = termId;
+    if (terms.size() * 2 > buckets.size()) {
+        rehash(buckets.size() * 2);
+    }
+
+    auto it = std::lower_bound(recent.begin(), recent.end(), key, [this](uint32_t id, std::string_view value) {
+        return keyOf(id) < value;
+    });
+    recent.insert(it, termId);
+    return termId;
+}
+
+void CompletionIndex::addWeight(uint32_t termId) {
+    if (weights[termId]++ == 0) {
+        liveTerms++;
+    }
+
+    uint32_t position = positions[termId];
+    if (position != NO_POSITION) {
+        uint32_t weight = ++sortedWeights[position];
+        uint32_t& blockWeight = blockMax[position / BLOCK_SIZE];
+        blockWeight = std::max(blockWeight, weight);
+    }
+}
+
+void CompletionIndex::dropWeight(uint32_t termId) {
+    if (--weights[termId] == 0) {
+        liveTerms--;
+    }
+
+    uint32_t position = positions[termId];
+    if (position == NO_POSITION) return;
+
+    uint32_t previous = sortedWeights[position]--;
+    size_t block = position / BLOCK_SIZE;
+    if (blockMax[block] == previous) {
+        size_t from = block * BLOCK_SIZE;
+        size_t until = std::min(sorted.size(), from + BLOCK_SIZE);
+        blockMax[block] = *std::max_element(sortedWeights.begin() + from, sortedWeights.begin() + until);
+    }
+}
+
+// Fold recent into sorted. Only the recent terms are searched for; the runs
+// between them are copied.
+void CompletionIndex::merge() {
+    std::vector<uint32_t> mergedIds;
+    std::vector<uint32_t> mergedWeights;
+    mergedIds.reserve(sorted.size() + recent.size());
+    mergedWeights.reserve(sorted.size() + recent.size());
+
+    size_t from = 0;
+    for (uint32_t termId : recent) {
+        size_t until = static_cast<size_t>(std::lower_bound(sorted.begin() + from, sorted.end(), keyOf(termId),
+                                                            [this](uint32_t id, std::string_view value) {
+            return keyOf(id) < value;
+        }) - sorted.begin());
+        mergedIds.insert(mergedIds.end(), sorted.begin() + from, sorted.begin() + until);
+        mergedWeights.insert(mergedWeights.end(), sortedWeights.begin() + from, sortedWeights.begin() + until);
+        mergedIds.push_back(termId);
+        mergedWeights.push_back(weights[termId]);
+        from = until;
+    }
+    mergedIds.insert(mergedIds.end(), sorted.begin() + from, sorted.end());
+    mergedWeights.insert(mergedWeights.end(), sortedWeights.begin() + from, sortedWeights.end());
+
+    sorted.swap(mergedIds);
+    sortedWeights.swap(mergedWeights);
+    recent.clear();
+
+    // Terms no owner carries any more keep their place (and text) until
+    // they outnumber the live ones
+    if (sorted.size() > 2 * liveTerms + MAX_RECENT) {
+        compactTerms();
+    }
+
+    for (size_t i = 0; i < sorted.size(); i++) {
+        positions[sorted[i]] = static_cast<uint32_t>(i);
+    }
+    blockMax.assign((sorted.size() + BLOCK_SIZE - 1) / BLOCK_SIZE, 0);
+    for (size_t i = 0; i < sortedWeights.size(); i++) {
+        uint32_t& blockWeight = blockMax[i / BLOCK_SIZE];
+        blockWeight = std::max(blockWeight, sortedWeights[i]);
+    }
+}
+
+// Drop unused terms and renumber the rest 0..n-1 in key order
+void CompletionIndex::compactTerms() {
+    std::vector<uint32_t> renumbered(terms.size(), NO_TERM);
+    std::string packedKeys;
+    std::string packedDisplays;
+    std::vector<Term> packedTerms;
+    std::vector<uint32_t> packedIds;
+    std::vector<uint32_t> packedWeights;
+    packedTerms.reserve(liveTerms);
+    packedIds.reserve(liveTerms);
+    packedWeights.reserve(liveTerms);
+
+    for (uint32_t termId : sorted) {
+        if (weights[termId] == 0) continue;
+        const Term& term = terms[termId];
+        uint32_t packedId = static_cast<uint32_t>(packedTerms.size());
+        renumbered[termId] = packedId;
+        packedTerms.push_back({static_cast<uint32_t>(packedKeys.size()), term.length});
+        packedKeys.append(keys, term.offset, term.length);
+        packedDisplays.append(displays, term.offset, term.length);
+        packedIds.push_back(packedId);
+        packedWeights.push_back(weights[termId]);
+    }
+
+    for (uint32_t& termId : ownerTerms) {
+        if (termId != NO_TERM) {
+            termId = renumbered[termId];
+        }
+    }
+
+    keys.swap(packedKeys);
+    displays.swap(packedDisplays);
+    terms.swap(packedTerms);
+    weights = packedWeights;
+    sorted.swap(packedIds);
+    sortedWeights.swap(packedWeights);
+    positions.assign(terms.size(), NO_POSITION);
+    rehash(buckets.size());
+}
+
+void CompletionIndex::rehash(size_t bucketCount) {
+    while (bucketCount < terms.size() * 2 || bucketCount < MIN_BUCKETS) {
+        bucketCount *= 2;
+    }
+    buckets.assign(bucketCount, NO_TERM);
+
+    size_t mask = bucketCount - 1;
+    for (uint32_t termId = 0; termId < terms.size(); termId++) {
+        size_t bucket = hashOf(keyOf(termId)) & mask;
+        while (buckets[bucket] != NO_TERM) {
+            bucket = (bucket + 1) & mask;
+        }
+        buckets[bucket] = termId;
+    }
+}
+
+} // namespace HotelManagement
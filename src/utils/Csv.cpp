@@ -0,0 +1,197 @@
+#include "utils/Csv.hpp"
+#include <algorithm>
+
+namespace HotelManagement {
+
+CsvReader::CsvReader(std::istream& in) : input(in) {}
+
+bool CsvReader::next(std::vector<std::string>& fields) {
+    fields.clear();
+
+    if (!std::getline(input, line)) {
+        return false;
+    }
+    currentLine++;
+    recordLine = currentLine;
+
+    std::string field;
+    bool quoted = false;
+    size_t i = 0;
+    for (;;) {
+        if (i == line.size()) {
+            if (!quoted) {
+                break;
+            }
+            // Quoted field continues on the next line
+            if (!std::getline(input, line)) {
+                break;
+            }
+            currentLine++;
+            field += '\n';
+            i = 0;
+            continue;
+        }
+
+        char c = line[i++];
+        if (quoted) {
+            if (c == '"') {
+                if (i < line.size() && line[i] == '"') {
+                    field += '"';
+                    i++;
+                } else {
+                    quoted = false;
+                }
+            } else {
+                field += c;
+            }
+        } else if (c == '"') {
+            quoted = true;
+        } else if (c == ',') {
+            fields.push_back(std::move(field));
+            field.clear();
+        } else if (c != '\r' || i != line.size()) {
+            field += c;
+        }
+    }
+
+    fields.push_back(std::move(field));
+    return true;
+}
+
+CsvBufferReader::CsvBufferReader(std::string_view buffer, size_t firstLine)
+    : data(buffer), currentLine(firstLine) {}
+
+bool CsvBufferReader::next(std::vector<std::string>& fields) {
+    fields.clear();
+    if (pos >= data.size()) {
+        return false;
+    }
+    recordLine = currentLine;
+
+    for (;;) {
+        size_t end = pos;
+        while (end < data.size() && data[end] != ',' && data[end] != '\n' && data[end] != '"') {
+            end++;
+        }
+
+        std::string field(data.substr(pos, end - pos));
+        pos = end;
+        if (pos < data.size() && data[pos] == '"') {
+            // Quotes in play: decode the rest of the field like CsvReader
+            bool quoted = false;
+            while (pos < data.size()) {
+                char c = data[pos];
+                if (!quoted && (c == ',' || c == '\n')) {
+                    break;
+                }
+                pos++;
+                if (c == '"') {
+                    if (quoted && pos < data.size() && data[pos] == '"') {
+                        field += '"';
+                        pos++;
+                    } else {
+                        quoted = !quoted;
+                    }
+                } else {
+                    if (c == '\n') {
+                        currentLine++;
+                    }
+                    field += c;
+                }
+            }
+        }
+
+        // Drop the \r of a CRLF line ending
+        if (!field.empty() && field.back() == '\r' && (pos == data.size() || data[pos] == '\n')) {
+            field.pop_back();
+        }
+        fields.push_back(std::move(field));
+
+        if (pos >= data.size()) {
+            return true;
+        }
+        if (data[pos++] == '\n') {
+            currentLine++;
+            return true;
+        }
+    }
+}
+
+size_t CsvBufferReader::findRecordEnd(std::string_view data, size_t start, size_t minEnd, size_t& lines) {
+    bool quoted = false;
+    for (size_t i = start; i < data.size(); i++) {
+        char c = data[i];
+        if (c == '"') {
+            quoted = !quoted; // an escaped "" toggles twice
+        } else if (c == '\n') {
+            lines++;
+            if (!quoted && i + 1 >= minEnd) {
+                return i + 1;
+            }
+        }
+    }
+    return data.size();
+}
+
+CsvWriter::CsvWriter(std::ostream& out) : output(out) {}
+
+void CsvWriter::writeRow(const std::vector<std::string>& fields) {
+    buffer.clear();
+    for (size_t i = 0; i < fields.size(); i++) {
+        if (i > 0) {
+            buffer += ',';
+        }
+        appendField(fields[i]);
+    }
+    buffer += '\n';
+    output << buffer;
+}
+
+void CsvWriter::writeRow(std::initializer_list<std::string_view> fields) {
+    buffer.clear();
+    bool first = true;
+    for (auto field : fields) {
+        if (!first) {
+            buffer += ',';
+        }
+        first = false;
+        appendField(field);
+    }
+    buffer += '\n';
+    output << buffer;
+}
+
+void CsvWriter::appendField(std::string_view field) {
+    bool needsQuotes = field.find_first_of(",\"\r\n") != std::string_view::npos;
+    if (!needsQuotes) {
+        buffer += field;
+        return;
+    }
+
+    buffer += '"';
+    for (char c : field) {
+        if (c == '"') {
+            buffer += '"';
+        }
+        buffer += c;
+    }
+    buffer += '"';
+}
+
+CsvHeader::CsvHeader(const std::vector<std::string>& headerNames) : names(headerNames) {}
+
+int CsvHeader::indexOf(std::string_view name) const {
+    auto it = std::find(names.begin(), names.end(), name);
+    return it == names.end() ? -1 : static_cast<int>(it - names.begin());
+}
+
+const std::string& CsvHeader::get(const std::vector<std::string>& fields, std::string_view name) const {
+    static const std::string empty;
+    int index = indexOf(name);
+    if (index < 0 || static_cast<size_t>(index) >= fields.size()) {
+        return empty;
+    }
+    return fields[static_cast<size_t>(index)];
+}
+
+} // namespace HotelManagement
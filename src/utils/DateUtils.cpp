@@ -3,13 +3,16 @@
 #include <sstream>
 #include <iomanip>
 #include <ctime>
-#include <regex>
 
 namespace HotelManagement {
 
 std::string DateUtils::getCurrentDate() {
-    auto now = std::chrono::system_clock::now();
-    return formatDate(now);
+    return getToday().toString();
+}
+
+CivilDate DateUtils::getToday() {
+    std::tm tm = timePointToTm(std::chrono::system_clock::now());
+    return CivilDate::fromYmd(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday);
 }
 
 std::string DateUtils::getCurrentDateTime() {
@@ -32,18 +35,15 @@ std::string DateUtils::formatDateTime(const std::chrono::system_clock::time_poin
 }
 
 std::optional<std::chrono::system_clock::time_point> DateUtils::parseDate(const std::string& dateStr) {
-    if (!isValidDate(dateStr)) {
+    CivilDate date = toCivilDate(dateStr);
+    if (!date.isValid()) {
         return std::nullopt;
     }
 
     std::tm tm = {};
-    std::istringstream iss(dateStr);
-    iss >> std::get_time(&tm, "%Y-%m-%d");
-
-    if (iss.fail()) {
-        return std::nullopt;
-    }
-
+    tm.tm_year = date.year() - 1900;
+    tm.tm_mon = date.month() - 1;
+    tm.tm_mday = date.day();
     return tmToTimePoint(tm);
 }
 
@@ -64,15 +64,15 @@ std::optional<std::chrono::system_clock::time_point> DateUtils::parseDateTime(co
 }
 
 int DateUtils::daysBetween(const std::string& startDate, const std::string& endDate) {
-    auto start = parseDate(startDate);
-    auto end = parseDate(endDate);
+    CivilDate start = toCivilDate(startDate);
+    CivilDate end = toCivilDate(endDate);
 
-    if (!start.has_value() || !end.has_value()) {
+    if (!start.isValid() || !end.isValid()) {
         Logger::error("Invalid date format in daysBetween: ", startDate, " or ", endDate);
         return 0;
     }
 
-    return daysBetween(start.value(), end.value());
+    return end - start;
 }
 
 int DateUtils::daysBetween(const std::chrono::system_clock::time_point& start,
@@ -82,63 +82,36 @@ int DateUtils::daysBetween(const std::chrono::system_clock::time_point& start,
 }
 
 bool DateUtils::isValidDate(const std::string& dateStr) {
-    // Check format YYYY-MM-DD
-    std::regex dateRegex(R"(^\d{4}-\d{2}-\d{2}$)");
-    if (!std::regex_match(dateStr, dateRegex)) {
-        return false;
-    }
-
-    // Parse and validate actual date values
-    std::tm tm = {};
-    std::istringstream iss(dateStr);
-    iss >> std::get_time(&tm, "%Y-%m-%d");
-
-    if (iss.fail()) {
-        return false;
-    }
-
-    // Additional validation
-    int year = tm.tm_year + 1900;
-    int month = tm.tm_mon + 1;
-    int day = tm.tm_mday;
-
-    if (year < 1900 || year > 2100) return false;
-    if (month < 1 || month > 12) return false;
-    if (day < 1 || day > getDaysInMonth(year, month)) return false;
-
-    return true;
+    return toCivilDate(dateStr).isValid();
 }
 
 bool DateUtils::isValidDateTime(const std::string& dateTimeStr) {
     // Check format YYYY-MM-DD HH:MM:SS
-    std::regex dateTimeRegex(R"(^\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}$)");
-    if (!std::regex_match(dateTimeStr, dateTimeRegex)) {
+    if (dateTimeStr.size() != 19 || dateTimeStr[10] != ' ' ||
+        dateTimeStr[13] != ':' || dateTimeStr[16] != ':') {
         return false;
     }
-
-    // Parse and validate
-    std::tm tm = {};
-    std::istringstream iss(dateTimeStr);
-    iss >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
-
-    if (iss.fail()) {
+    if (!isValidDate(dateTimeStr.substr(0, 10))) {
         return false;
     }
 
-    // Additional validation
-    int year = tm.tm_year + 1900;
-    int month = tm.tm_mon + 1;
-    int day = tm.tm_mday;
-    int hour = tm.tm_hour;
-    int min = tm.tm_min;
-    int sec = tm.tm_sec;
-
-    if (year < 1900 || year > 2100) return false;
-    if (month < 1 || month > 12) return false;
-    if (day < 1 || day > getDaysInMonth(year, month)) return false;
-    if (hour < 0 || hour > 23) return false;
-    if (min < 0 || min > 59) return false;
-    if (sec < 0 || sec > 59) return false;
+    int fields[3] = {};
+    for (int i = 0; i < 3; i++) {
+        char high = dateTimeStr[11 + i * 3];
+        char low = dateTimeStr[12 + i * 3];
+        if (high < '0' || high > '9' || low < '0' || low > '9') {
+            return false;
+        }
+        fields[i] = (high - '0') * 10 + (low - '0');
+    }
+
+    int hour = fields[0];
+    int min = fields[1];
+    int sec = fields[2];
+
+    if (hour > 23) return false;
+    if (min > 59) return false;
+    if (sec > 59) return false;
 
     return true;
 }
@@ -146,26 +119,25 @@ bool DateUtils::isValidDateTime(const std::string& dateTimeStr) {
 bool DateUtils::isDateInRange(const std::string& date,
                               const std::string& startDate,
                               const std::string& endDate) {
-    auto datePoint = parseDate(date);
-    auto startPoint = parseDate(startDate);
-    auto endPoint = parseDate(endDate);
+    CivilDate day = toCivilDate(date);
+    CivilDate start = toCivilDate(startDate);
+    CivilDate end = toCivilDate(endDate);
 
-    if (!datePoint.has_value() || !startPoint.has_value() || !endPoint.has_value()) {
+    if (!day.isValid() || !start.isValid() || !end.isValid()) {
         return false;
     }
 
-    return datePoint.value() >= startPoint.value() && datePoint.value() <= endPoint.value();
+    return day >= start && day <= end;
 }
 
 std::string DateUtils::addDays(const std::string& dateStr, int days) {
-    auto timePoint = parseDate(dateStr);
-    if (!timePoint.has_value()) {
+    CivilDate date = toCivilDate(dateStr);
+    if (!date.isValid()) {
         Logger::error("Invalid date format in addDays: ", dateStr);
         return dateStr;
     }
 
-    auto newTimePoint = timePoint.value() + std::chrono::hours(24 * days);
-    return formatDate(newTimePoint);
+    return (date + days).toString();
 }
 
 std::string DateUtils::subtractDays(const std::string& dateStr, int days) {
@@ -173,71 +145,63 @@ std::string DateUtils::subtractDays(const std::string& dateStr, int days) {
 }
 
 int DateUtils::compareDates(const std::string& date1, const std::string& date2) {
-    auto tp1 = parseDate(date1);
-    auto tp2 = parseDate(date2);
+    CivilDate first = toCivilDate(date1);
+    CivilDate second = toCivilDate(date2);
 
-    if (!tp1.has_value() || !tp2.has_value()) {
+    if (!first.isValid() || !second.isValid()) {
         Logger::error("Invalid date format in compareDates");
         return 0;
     }
 
-    if (tp1.value() < tp2.value()) return -1;
-    if (tp1.value() > tp2.value()) return 1;
+    if (first < second) return -1;
+    if (first > second) return 1;
     return 0;
 }
 
 bool DateUtils::isLeapYear(int year) {
-    return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+    return CivilDate::isLeapYear(year);
 }
 
 int DateUtils::getDaysInMonth(int year, int month) {
-    static const int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-
-    if (month < 1 || month > 12) {
-        return 0;
-    }
-
-    if (month == 2 && isLeapYear(year)) {
-        return 29;
-    }
-
-    return daysInMonth[month - 1];
+    return CivilDate::daysInMonth(year, month);
 }
 
 int DateUtils::getDayOfWeek(const std::string& dateStr) {
-    auto timePoint = parseDate(dateStr);
-    if (!timePoint.has_value()) {
+    CivilDate date = toCivilDate(dateStr);
+    if (!date.isValid()) {
         Logger::error("Invalid date format in getDayOfWeek: ", dateStr);
         return 0;
     }
 
-    std::tm tm = timePointToTm(timePoint.value());
-    return tm.tm_wday;
+    return date.dayOfWeek();
 }
 
 int DateUtils::getWeekOfYear(const std::string& dateStr) {
-    auto timePoint = parseDate(dateStr);
-    if (!timePoint.has_value()) {
+    CivilDate date = toCivilDate(dateStr);
+    if (!date.isValid()) {
         Logger::error("Invalid date format in getWeekOfYear: ", dateStr);
         return 0;
     }
 
-    std::tm tm = timePointToTm(timePoint.value());
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%W");
-    return std::stoi(oss.str());
+    // Same as strftime %W: weeks start on Monday, days before the first Monday are week 0
+    int dayOfYear = date - CivilDate::fromYmd(date.year(), 1, 1);
+    int daysSinceMonday = (date.dayOfWeek() + 6) % 7;
+    return (dayOfYear + 7 - daysSinceMonday) / 7;
 }
 
 std::string DateUtils::formatDateForDisplay(const std::string& dateStr) {
-    auto timePoint = parseDate(dateStr);
-    if (!timePoint.has_value()) {
+    static const char* const monthNames[] = {
+        "January", "February", "March", "April", "May", "June",
+        "July", "August", "September", "October", "November", "December"
+    };
+
+    CivilDate date = toCivilDate(dateStr);
+    if (!date.isValid()) {
         return dateStr;
     }
 
-    std::tm tm = timePointToTm(timePoint.value());
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%B %d, %Y");
-    return oss.str();
+    char day[3] = {static_cast<char>('0' + date.day() / 10), static_cast<char>('0' + date.day() % 10), '\0'};
+    return std::string(monthNames[date.month() - 1]) + " " + day + ", " + std::to_string(date.year());
 }
 
 std::string DateUtils::getCurrentTime() {
@@ -249,6 +213,14 @@ std::string DateUtils::getCurrentTime() {
 }
 
 // Private helper functions
+CivilDate DateUtils::toCivilDate(const std::string& dateStr) {
+    CivilDate date = CivilDate::parse(dateStr);
+    if (!date.isValid() || date.year() < 1900 || date.year() > 2100) {
+        return CivilDate();
+    }
+    return date;
+}
+
 std::chrono::system_clock::time_point DateUtils::tmToTimePoint(const std::tm& tm) {
     std::tm tm_copy = tm;
     std::time_t time = std::mktime(&tm_copy);
@@ -0,0 +1,130 @@
+#include "utils/FramePacer.hpp"
+#include <algorithm>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace HotelManagement {
+
+namespace {
+
+// ImGui needs a couple of frames after an input to settle hover and layout
+constexpr int SETTLE_FRAMES = 3;
+
+constexpr std::chrono::seconds STATS_WINDOW{1};
+
+// CPU seconds used by the whole process so far
+double processCpuSeconds() {
+#ifdef _WIN32
+    FILETIME created, exited, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) {
+        return 0.0;
+    }
+    auto ticks = [](const FILETIME& time) {
+        return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+    return static_cast<double>(ticks(kernel) + ticks(user)) / 1e7; // 100 ns ticks
+#else
+    timespec time{};
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0) {
+        return 0.0;
+    }
+    return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) / 1e9;
+#endif
+}
+
+double millisecondsBetween(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+} // namespace
+
+FramePacer::FramePacer(int targetFps, bool idleWait, std::chrono::milliseconds idleWakeup)
+    : frameInterval(targetFps > 0
+                        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetFps))
+                        : Clock::duration::zero()),
+      idleWait(idleWait),
+      idleWakeup(std::max(idleWakeup, std::chrono::milliseconds(1))),
+      activeFrames(SETTLE_FRAMES),
+      nextFrame(Clock::now()),
+      windowStart(Clock::now()),
+      windowCpuStart(processCpuSeconds()) {}
+
+void FramePacer::markActive() {
+    activeFrames = SETTLE_FRAMES;
+}
+
+double FramePacer::idleTimeoutSeconds() const {
+    return std::chrono::duration<double>(idleWakeup).count();
+}
+
+void FramePacer::beginWait() {
+    waitStart = Clock::now();
+}
+
+void FramePacer::endWait() {
+    windowIdleMs += millisecondsBetween(waitStart, Clock::now());
+}
+
+void FramePacer::waitForFrameSlot() {
+    if (frameInterval == Clock::duration::zero()) {
+        return;
+    }
+    Clock::time_point now = Clock::now();
+    if (now < nextFrame) {
+        std::this_thread::sleep_until(nextFrame);
+        windowIdleMs += millisecondsBetween(now, Clock::now());
+    }
+}
+
+void FramePacer::beginFrame() {
+    frameStart = Clock::now();
+}
+
+void FramePacer::endFrame() {
+    Clock::time_point now = Clock::now();
+    double frameMs = millisecondsBetween(frameStart, now);
+    windowFrames++;
+    windowFrameMs += frameMs;
+    windowMaxFrameMs = std::max(windowMaxFrameMs, frameMs);
+    current.totalFrames++;
+
+    if (activeFrames > 0) {
+        activeFrames--;
+    }
+
+    // Schedule from the previous slot so the rate holds on average, but
+    // never try to catch up after a long frame or an idle wait
+    nextFrame = std::max(nextFrame + frameInterval, now);
+
+    if (now - windowStart >= STATS_WINDOW) {
+        closeWindow(now);
+    }
+}
+
+void FramePacer::closeWindow(Clock::time_point now) {
+    double wallMs = millisecondsBetween(windowStart, now);
+    double cpu = processCpuSeconds();
+
+    current.fps = windowFrames * 1000.0 / wallMs;
+    current.frameMs = windowFrames > 0 ? windowFrameMs / windowFrames : 0.0;
+    current.maxFrameMs = windowMaxFrameMs;
+    current.cpuPercent = (cpu - windowCpuStart) * 1000.0 / wallMs * 100.0;
+    current.idlePercent = std::min(100.0, windowIdleMs / wallMs * 100.0);
+
+    windowStart = now;
+    windowCpuStart = cpu;
+    windowFrames = 0;
+    windowFrameMs = 0.0;
+    windowMaxFrameMs = 0.0;
+    windowIdleMs = 0.0;
+}
+
+} // namespace HotelManagement
@@ -0,0 +1,252 @@
+#include "utils/LogRotator.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#ifdef HOTEL_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace HotelManagement {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::tm toLocalTime(std::chrono::system_clock::time_point time) {
+    std::time_t t = std::chrono::system_clock::to_time_t(time);
+    std::tm tm_buf;
+#ifdef _WIN32
+    localtime_s(&tm_buf, &t);
+#else
+    localtime_r(&t, &tm_buf);
+#endif
+    return tm_buf;
+}
+
+bool isDigits(const std::string& text, size_t pos, size_t count) {
+    if (pos + count > text.size()) {
+        return false;
+    }
+    return std::all_of(text.begin() + pos, text.begin() + pos + count,
+                       [](char c) { return c >= '0' && c <= '9'; });
+}
+
+// True for <prefix>YYYY-MM-DD_HHMMSSmmm[_N]<extension>[.gz], the names
+// archivePath() produces
+bool isArchiveName(const std::string& name, const std::string& prefix, const std::string& extension) {
+    if (name.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+
+    size_t pos = prefix.size();
+    if (!isDigits(name, pos, 4) || name.compare(pos + 4, 1, "-") != 0 || !isDigits(name, pos + 5, 2) ||
+        name.compare(pos + 7, 1, "-") != 0 || !isDigits(name, pos + 8, 2) || name.compare(pos + 10, 1, "_") != 0 ||
+        !isDigits(name, pos + 11, 9)) {
+        return false;
+    }
+    pos += 20;
+
+    // Collision suffix
+    if (pos < name.size() && name[pos] == '_') {
+        size_t digits = 0;
+        while (isDigits(name, pos + 1 + digits, 1)) {
+            digits++;
+        }
+        if (digits == 0) {
+            return false;
+        }
+        pos += 1 + digits;
+    }
+
+    std::string rest = name.substr(pos);
+    return rest == extension || rest == extension + ".gz";
+}
+
+} // namespace
+
+LogRotator::LogRotator(std::string path, const LogRotationOptions& opts)
+    : logPath(std::move(path)), options(opts) {
+    fs::path p(logPath);
+    extension = p.extension().string();
+    stem = (p.parent_path() / p.stem()).string();
+
+    worker = std::thread(&LogRotator::workerLoop, this);
+}
+
+LogRotator::~LogRotator() {
+    {
+        std::lock_guard<std::mutex> lock(workMutex);
+        stopping = true;
+    }
+    workReady.notify_one();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void LogRotator::reset(uint64_t currentBytes, std::chrono::system_clock::time_point now) {
+    bytesWritten = currentBytes;
+    rotateAt = options.daily ? nextLocalMidnight(now) : std::chrono::system_clock::time_point::max();
+}
+
+bool LogRotator::recordWrite(uint64_t bytes, std::chrono::system_clock::time_point now) {
+    bytesWritten += bytes;
+    return (options.maxBytes > 0 && bytesWritten >= options.maxBytes) || now >= rotateAt;
+}
+
+bool LogRotator::rotate(std::chrono::system_clock::time_point now) {
+    std::string archive = archivePath(now);
+
+    std::error_code ec;
+    fs::rename(logPath, archive, ec);
+    if (ec) {
+        // Logger cannot log its own failures; report on stderr, keep appending
+        // and try again after another maxBytes
+        std::cerr << "Log rotation failed: " << ec.message() << std::endl;
+        reset(0, now);
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(workMutex);
+        pending.push_back(archive);
+    }
+    workReady.notify_one();
+    return true;
+}
+
+bool LogRotator::isCompressionAvailable() {
+#ifdef HOTEL_HAVE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+void LogRotator::workerLoop() {
+    std::unique_lock<std::mutex> lock(workMutex);
+    for (;;) {
+        workReady.wait(lock, [this] { return stopping || !pending.empty(); });
+        if (pending.empty()) {
+            return; // stopping with nothing left to do
+        }
+
+        std::vector<std::string> batch;
+        batch.swap(pending);
+        lock.unlock();
+
+        for (const auto& path : batch) {
+            if (options.compress) {
+                compressFile(path);
+            }
+        }
+        enforceRetention();
+
+        lock.lock();
+    }
+}
+
+void LogRotator::compressFile(const std::string& path) {
+#ifdef HOTEL_HAVE_ZLIB
+    std::ifstream input(path, std::ios::binary);
+    if (!input) {
+        return;
+    }
+
+    std::string target = path + ".gz";
+    gzFile output = gzopen(target.c_str(), "wb6");
+    if (!output) {
+        std::cerr << "Log compression failed: cannot open " << target << std::endl;
+        return;
+    }
+
+    std::vector<char> buffer(64 * 1024);
+    bool ok = true;
+    while (input) {
+        input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        auto count = static_cast<unsigned>(input.gcount());
+        if (count > 0 && gzwrite(output, buffer.data(), count) != static_cast<int>(count)) {
+            ok = false;
+            break;
+        }
+    }
+
+    if (gzclose(output) != Z_OK || !ok) {
+        std::cerr << "Log compression failed for " << path << std::endl;
+        std::error_code ec;
+        fs::remove(target, ec);
+        return;
+    }
+
+    input.close();
+    std::error_code ec;
+    fs::remove(path, ec);
+#else
+    (void)path; // Built without zlib; rotated files stay uncompressed
+#endif
+}
+
+void LogRotator::enforceRetention() {
+    if (options.maxFiles <= 0) {
+        return;
+    }
+
+    fs::path base(stem);
+    fs::path directory = base.parent_path().empty() ? fs::path(".") : base.parent_path();
+    std::string prefix = base.filename().string() + ".";
+    fs::path activeName = fs::path(logPath).filename();
+
+    // Archive names embed a sortable timestamp, so name order is age order
+    std::vector<fs::path> archives;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        // Compare names only: "./hotel_system.log" and "hotel_system.log"
+        // are the same file but different paths
+        fs::path name = entry.path().filename();
+        bool rotated = name != activeName && isArchiveName(name.string(), prefix, extension);
+        if (rotated && entry.is_regular_file(ec)) {
+            archives.push_back(entry.path());
+        }
+    }
+
+    if (archives.size() <= static_cast<size_t>(options.maxFiles)) {
+        return;
+    }
+
+    std::sort(archives.begin(), archives.end());
+    size_t excess = archives.size() - static_cast<size_t>(options.maxFiles);
+    for (size_t i = 0; i < excess; i++) {
+        fs::remove(archives[i], ec);
+    }
+}
+
+std::string LogRotator::archivePath(std::chrono::system_clock::time_point now) const {
+    std::tm tm = toLocalTime(now);
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
+    char stamp[40];
+    size_t length = std::strftime(stamp, sizeof(stamp), "%Y-%m-%d_%H%M%S", &tm);
+    std::snprintf(stamp + length, sizeof(stamp) - length, "%03d", static_cast<int>(ms.count()));
+
+    // '_' sorts after '.', so a collision suffix keeps name order == age order
+    std::string path = stem + "." + stamp + extension;
+    for (int n = 1; fs::exists(path) || fs::exists(path + ".gz"); n++) {
+        path = stem + "." + stamp + "_" + std::to_string(n) + extension;
+    }
+    return path;
+}
+
+std::chrono::system_clock::time_point LogRotator::nextLocalMidnight(std::chrono::system_clock::time_point now) {
+    std::tm tm = toLocalTime(now);
+    tm.tm_hour = 0;
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    tm.tm_mday += 1;
+    tm.tm_isdst = -1;
+    return std::chrono::system_clock::from_time_t(std::mktime(&tm));
+}
+
+} // namespace HotelManagement
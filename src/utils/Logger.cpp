@@ -1,9 +1,105 @@
 #include "utils/Logger.hpp"
 #include <iostream>
 #include <ctime>
+#include <cstdio>
+#include <bit>
+#include <thread>
+#include <condition_variable>
+#include <filesystem>
 
 namespace HotelManagement {
 
+namespace {
+
+struct LogRecord {
+    LogLevel level = LogLevel::INFO;
+    std::chrono::system_clock::time_point time;
+    std::string message;
+};
+
+// Bounded lock-free queue for many producers and the single writer thread.
+// Each cell carries a sequence number telling producers and the consumer
+// whose turn it is (D. Vyukov's bounded queue), so pushes never take a lock.
+class LogRing {
+public:
+    explicit LogRing(size_t capacity)
+        : cells(new Cell[capacity]), mask(capacity - 1) {
+        for (size_t i = 0; i < capacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Returns false when the queue is full; record is left untouched then
+    bool tryPush(LogRecord& record) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.record = std::move(record);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer side; only the writer thread (or shutdown after it exits) calls this
+    bool tryPop(LogRecord& record) {
+        Cell& cell = cells[dequeuePos & mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(dequeuePos + 1) < 0) {
+            return false;
+        }
+        record = std::move(cell.record);
+        cell.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+        dequeuePos++;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        LogRecord record;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    const size_t mask;
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) size_t dequeuePos = 0;
+};
+
+} // namespace
+
+struct Logger::AsyncState {
+    explicit AsyncState(const AsyncLogOptions& opts)
+        : options(opts), ring(std::bit_ceil(std::max<size_t>(opts.queueCapacity, 2))) {}
+
+    // Wake the writer now instead of at the next interval
+    void requestFlush() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            flushRequested = true;
+        }
+        wake.notify_one();
+    }
+
+    AsyncLogOptions options;
+    LogRing ring;
+    std::thread writer;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    bool flushRequested = false;
+    bool stopRequested = false;
+    uint64_t reportedDrops = 0;
+};
+
 Logger::~Logger() {
     shutdownImpl();
 }
@@ -21,6 +117,22 @@ void Logger::setLevel(LogLevel level) {
     getInstance().setLevelImpl(level);
 }
 
+bool Logger::isEnabled(LogLevel level) {
+    return static_cast<int>(level) >= static_cast<int>(getInstance().currentLevel.load(std::memory_order_relaxed));
+}
+
+void Logger::enableAsync(const AsyncLogOptions& options) {
+    getInstance().enableAsyncImpl(options);
+}
+
+uint64_t Logger::getDroppedCount() {
+    return getInstance().droppedCount.load(std::memory_order_relaxed);
+}
+
+void Logger::setRotation(const LogRotationOptions& options) {
+    getInstance().setRotationImpl(options);
+}
+
 void Logger::debug(const std::string& message) {
     log(LogLevel::DEBUG, message);
 }
@@ -54,6 +166,7 @@ void Logger::initImpl(const std::string& filename) {
         return;
     }
 
+    logPath = filename;
     initialized = true;
 
     // Write initialization message
@@ -65,39 +178,190 @@ void Logger::initImpl(const std::string& filename) {
 }
 
 void Logger::setLevelImpl(LogLevel level) {
+    currentLevel.store(level, std::memory_order_relaxed);
+}
+
+void Logger::enableAsyncImpl(const AsyncLogOptions& options) {
     std::lock_guard<std::mutex> lock(logMutex);
-    currentLevel = level;
+
+    if (async) {
+        return; // Already enabled (the writer is started once per process)
+    }
+
+    async = std::make_unique<AsyncState>(options);
+    asyncRunning.store(true, std::memory_order_release);
+    async->writer = std::thread(&Logger::writerLoop, this);
 }
 
 void Logger::log(LogLevel level, const std::string& message) {
     getInstance().logImpl(level, message);
 }
 
-void Logger::logImpl(LogLevel level, const std::string& message) {
+void Logger::setRotationImpl(const LogRotationOptions& options) {
     std::lock_guard<std::mutex> lock(logMutex);
 
+    if (!initialized) {
+        return;
+    }
+
+    std::error_code ec;
+    auto currentSize = std::filesystem::file_size(logPath, ec);
+
+    rotator = std::make_unique<LogRotator>(logPath, options);
+    rotator->reset(ec ? 0 : currentSize, std::chrono::system_clock::now());
+}
+
+// Must be called with logMutex held
+void Logger::rotateFile(std::chrono::system_clock::time_point now) {
+    logFile.close();
+    bool rotated = rotator->rotate(now);
+    logFile.open(logPath, std::ios::app);
+
+    if (!logFile.is_open()) {
+        std::cerr << "Failed to reopen log file: " << logPath << std::endl;
+        initialized = false;
+        return;
+    }
+    if (rotated) {
+        rotator->reset(0, now);
+    }
+}
+
+void Logger::logImpl(LogLevel level, const std::string& message) {
     // Check if message should be logged based on current level
-    if (static_cast<int>(level) < static_cast<int>(currentLevel)) {
+    if (!isEnabled(level)) {
         return;
     }
 
-    std::string logEntry = getCurrentTimestamp() + " [" + levelToString(level) + "] " + message;
+    // Counted in before looking at asyncRunning, so stopWriter() can wait
+    // out every producer that may still push to the queue
+    asyncProducers.fetch_add(1);
+    if (asyncRunning.load()) {
+        LogRecord record{level, std::chrono::system_clock::now(), message};
+
+        bool queued = async->ring.tryPush(record);
+        while (!queued && async->options.overflowPolicy == LogOverflowPolicy::Block && asyncRunning.load()) {
+            async->requestFlush();
+            std::this_thread::yield();
+            queued = async->ring.tryPush(record);
+        }
+
+        if (queued) {
+            if (level == LogLevel::ERROR) {
+                async->requestFlush();
+            }
+            asyncProducers.fetch_sub(1);
+            return;
+        }
+        if (asyncRunning.load()) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            asyncProducers.fetch_sub(1);
+            return;
+        }
+        // The writer stopped while we waited; write synchronously instead
+    }
+    asyncProducers.fetch_sub(1);
+
+    std::lock_guard<std::mutex> lock(logMutex);
+    writeEntry(level, getCurrentTimestamp() + " [" + levelToString(level) + "] " + message);
 
-    // Write to file
+    // Ensure immediate write
     if (initialized && logFile.is_open()) {
-        logFile << logEntry << std::endl;
-        logFile.flush(); // Ensure immediate write
+        logFile.flush();
+    }
+    std::cout.flush();
+}
+
+// Must be called with logMutex held
+void Logger::writeEntry(LogLevel level, const std::string& entry) {
+    if (initialized && logFile.is_open()) {
+        logFile << entry << '\n';
+
+        if (rotator && rotator->recordWrite(entry.size() + 1, std::chrono::system_clock::now())) {
+            rotateFile(std::chrono::system_clock::now());
+        }
     }
 
     // Also output to console for ERROR and WARNING
     if (level == LogLevel::ERROR || level == LogLevel::WARNING) {
-        std::cerr << logEntry << std::endl;
+        std::cerr << entry << '\n';
     } else if (level == LogLevel::INFO) {
-        std::cout << logEntry << std::endl;
+        std::cout << entry << '\n';
+    }
+}
+
+void Logger::writerLoop() {
+    for (;;) {
+        bool stopping = false;
+        {
+            std::unique_lock<std::mutex> lock(async->wakeMutex);
+            async->wake.wait_for(lock, async->options.flushInterval, [this] {
+                return async->stopRequested || async->flushRequested;
+            });
+            async->flushRequested = false;
+            stopping = async->stopRequested;
+        }
+
+        // Write everything queued so far as one batch, then flush once
+        std::lock_guard<std::mutex> lock(logMutex);
+        LogRecord record;
+        while (async->ring.tryPop(record)) {
+            writeEntry(record.level, formatTimestamp(record.time) + " [" + levelToString(record.level) + "] " +
+                                     record.message);
+        }
+
+        uint64_t dropped = droppedCount.load(std::memory_order_relaxed);
+        if (dropped != async->reportedDrops) {
+            writeEntry(LogLevel::WARNING, getCurrentTimestamp() + " [" + levelToString(LogLevel::WARNING) +
+                                          "] Log queue full, dropped " +
+                                          std::to_string(dropped - async->reportedDrops) + " records");
+            async->reportedDrops = dropped;
+        }
+
+        if (initialized && logFile.is_open()) {
+            logFile.flush();
+        }
+        std::cout.flush();
+
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+void Logger::stopWriter() {
+    if (!async || !asyncRunning.exchange(false)) {
+        return;
+    }
+
+    // New records are written directly from here on. Wait for producers
+    // that saw the writer running: their records reach the queue while the
+    // writer still drains it, or at the latest before the drain below.
+    while (asyncProducers.load() != 0) {
+        std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(async->wakeMutex);
+        async->stopRequested = true;
+    }
+    async->wake.notify_one();
+    if (async->writer.joinable()) {
+        async->writer.join();
+    }
+
+    // Pick up records pushed after the writer's last batch
+    std::lock_guard<std::mutex> lock(logMutex);
+    LogRecord record;
+    while (async->ring.tryPop(record)) {
+        writeEntry(record.level, formatTimestamp(record.time) + " [" + levelToString(record.level) + "] " +
+                                 record.message);
     }
 }
 
 void Logger::shutdownImpl() {
+    stopWriter();
+
     std::lock_guard<std::mutex> lock(logMutex);
 
     if (initialized && logFile.is_open()) {
@@ -107,10 +371,16 @@ void Logger::shutdownImpl() {
         logFile.close();
         initialized = false;
     }
+
+    // Waits for any compression still in progress
+    rotator.reset();
 }
 
 std::string Logger::getCurrentTimestamp() {
-    auto now = std::chrono::system_clock::now();
+    return formatTimestamp(std::chrono::system_clock::now());
+}
+
+std::string Logger::formatTimestamp(std::chrono::system_clock::time_point now) {
     auto time = std::chrono::system_clock::to_time_t(now);
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         now.time_since_epoch()) % 1000;
@@ -122,11 +392,11 @@ std::string Logger::getCurrentTimestamp() {
     localtime_r(&time, &tm_buf);
 #endif
 
-    std::ostringstream oss;
-    oss << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S");
-    oss << '.' << std::setfill('0') << std::setw(3) << ms.count();
+    char buffer[32];
+    size_t length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &tm_buf);
+    std::snprintf(buffer + length, sizeof(buffer) - length, ".%03d", static_cast<int>(ms.count()));
 
-    return oss.str();
+    return buffer;
 }
 
 std::string Logger::levelToString(LogLevel level) {
@@ -0,0 +1,88 @@
+#include "utils/Profiler.hpp"
+#include <algorithm>
+
+namespace HotelManagement {
+
+namespace {
+
+// "std::vector<Guest> HotelManagement::GuestRepository::findAll()" and the
+// lambdas inside it become "GuestRepository::findAll"
+std::string shortCallerName(std::string_view function) {
+    size_t parameters = function.find('(');
+    std::string_view name = function.substr(0, parameters);
+
+    size_t returnType = name.rfind(' ');
+    if (returnType != std::string_view::npos) {
+        name.remove_prefix(returnType + 1);
+    }
+
+    // Keep the class and method only
+    size_t method = name.rfind("::");
+    if (method != std::string_view::npos && method > 0) {
+        size_t owner = name.rfind("::", method - 1);
+        if (owner != std::string_view::npos) {
+            name.remove_prefix(owner + 2);
+        }
+    }
+    return std::string(name.empty() ? function : name);
+}
+
+} // namespace
+
+const char* Profiler::phaseName(FramePhase phase) {
+    switch (phase) {
+        case FramePhase::Events: return "Events";
+        case FramePhase::Update: return "Update";
+        case FramePhase::BuildUi: return "Build UI";
+        case FramePhase::Submit: return "GL submit";
+    }
+    return "";
+}
+
+void Profiler::addPhase(FramePhase phase, double ms) {
+    currentFrame[static_cast<size_t>(phase)] += ms;
+}
+
+void Profiler::endFrame() {
+    double total = 0.0;
+    for (size_t i = 0; i < FRAME_PHASE_COUNT; i++) {
+        phases[i].push(static_cast<float>(currentFrame[i]));
+        total += currentFrame[i];
+    }
+    totals.push(static_cast<float>(total));
+    currentFrame.fill(0.0);
+}
+
+void Profiler::recordQuery(const char* caller, double ms) {
+    std::lock_guard<std::mutex> lock(queryMutex);
+
+    auto known = seriesByCaller.find(caller);
+    size_t index;
+    if (known != seriesByCaller.end()) {
+        index = known->second;
+    } else {
+        std::string name = shortCallerName(caller);
+        auto named = seriesByName.find(name);
+        if (named != seriesByName.end()) {
+            index = named->second;
+        } else {
+            index = queries.size();
+            queries.emplace_back().name = name;
+            seriesByName.emplace(std::move(name), index);
+        }
+        seriesByCaller.emplace(caller, index);
+    }
+
+    QuerySeries& series = queries[index];
+    series.latencyMs.push(static_cast<float>(ms));
+    series.calls++;
+    series.totalMs += ms;
+    series.maxMs = std::max(series.maxMs, static_cast<float>(ms));
+}
+
+std::vector<Profiler::QuerySeries> Profiler::querySeries() const {
+    std::lock_guard<std::mutex> lock(queryMutex);
+    return queries;
+}
+
+} // namespace HotelManagement
@@ -0,0 +1,59 @@
+#include "utils/StartupTimeline.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace HotelManagement {
+
+namespace {
+
+long long millisecondsBetween(StartupTimeline::Clock::time_point from, StartupTimeline::Clock::time_point to) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(to - from).count();
+}
+
+} // namespace
+
+StartupTimeline::StartupTimeline()
+    : origin(Clock::now()), mainThread(std::this_thread::get_id()) {}
+
+void StartupTimeline::record(std::string name, Clock::time_point start, Clock::time_point end) {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.push_back(Entry{std::move(name), start, end, std::this_thread::get_id()});
+}
+
+void StartupTimeline::log() const {
+    std::vector<Entry> phases;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        phases = entries;
+    }
+    std::stable_sort(phases.begin(), phases.end(), [](const Entry& a, const Entry& b) {
+        return a.start < b.start;
+    });
+
+    Logger::info("Startup timeline (offset, duration, thread, phase):");
+
+    // Worker threads are numbered in the order they first appear
+    std::vector<std::thread::id> workers;
+    Clock::time_point finished = origin;
+    for (const Entry& phase : phases) {
+        std::string thread = "main";
+        if (phase.thread != mainThread) {
+            auto known = std::find(workers.begin(), workers.end(), phase.thread);
+            if (known == workers.end()) {
+                known = workers.insert(workers.end(), phase.thread);
+            }
+            thread = "worker " + std::to_string(known - workers.begin() + 1);
+        }
+        finished = std::max(finished, phase.end);
+
+        char line[160];
+        std::snprintf(line, sizeof(line), "  +%5lld ms %6lld ms  %-9s %s",
+                      millisecondsBetween(origin, phase.start), millisecondsBetween(phase.start, phase.end),
+                      thread.c_str(), phase.name.c_str());
+        Logger::info(line);
+    }
+    Logger::info("Startup finished in ", millisecondsBetween(origin, finished), " ms (", phases.size(), " phases)");
+}
+
+} // namespace HotelManagement
@@ -0,0 +1,36 @@
+#include "utils/TableText.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace HotelManagement {
+
+TableText::TableText(size_t columnCount)
+    : columns(std::max<size_t>(1, columnCount)) {}
+
+void TableText::reserve(size_t rowCount, size_t bytesPerRow) {
+    text.reserve(rowCount * bytesPerRow);
+    offsets.reserve(rowCount * columns);
+}
+
+void TableText::addRow(std::initializer_list<std::string_view> cells) {
+    size_t needed = columns;
+    for (std::string_view cell : cells) {
+        needed += cell.size();
+    }
+    if (text.size() + needed > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("TableText exceeds 4 GB");
+    }
+
+    auto cell = cells.begin();
+    for (size_t column = 0; column < columns; column++) {
+        offsets.push_back(static_cast<uint32_t>(text.size()));
+        if (cell != cells.end()) {
+            text.append(*cell);
+            ++cell;
+        }
+        text.push_back('\0');
+    }
+}
+
+} // namespace HotelManagement
@@ -1,20 +1,158 @@
 #include "utils/Validators.hpp"
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cstdint>
 #include <stdexcept>
+#include <string_view>
 
 namespace HotelManagement {
 
+namespace {
+
+// Each validator accepts exactly what its former std::regex pattern did; the
+// bracket expressions are reused verbatim as CharClass specs.
+
+// Set of bytes, built at compile time from regex bracket syntax:
+// ranges (a-z), escapes (\- \.) and \s for ECMAScript whitespace
+class CharClass {
+public:
+    constexpr explicit CharClass(std::string_view spec) {
+        for (size_t i = 0; i < spec.size(); i++) {
+            char c = spec[i];
+            if (c == '\\' && i + 1 < spec.size()) {
+                char escaped = spec[++i];
+                if (escaped == 's') {
+                    for (char ws : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+                        add(ws);
+                    }
+                } else {
+                    add(escaped);
+                }
+            } else if (i + 2 < spec.size() && spec[i + 1] == '-') {
+                for (int b = byte(c); b <= byte(spec[i + 2]); b++) {
+                    bits[b >> 6] |= uint64_t{1} << (b & 63);
+                }
+                i += 2;
+            } else {
+                add(c);
+            }
+        }
+    }
+
+    constexpr bool contains(char c) const {
+        int b = byte(c);
+        return (bits[b >> 6] >> (b & 63)) & 1;
+    }
+
+    // Non-empty and every character in the class, i.e. ^[...]+$
+    bool containsAll(std::string_view str) const {
+        return !str.empty() && std::all_of(str.begin(), str.end(), [this](char c) { return contains(c); });
+    }
+
+private:
+    std::array<uint64_t, 4> bits{};
+
+    static constexpr int byte(char c) { return static_cast<unsigned char>(c); }
+
+    constexpr void add(char c) {
+        int b = byte(c);
+        bits[b >> 6] |= uint64_t{1} << (b & 63);
+    }
+};
+
+// One regex term: a character class repeated min..max times
+struct Repeat {
+    CharClass chars;
+    int min;
+    int max;
+};
+
+// Match a concatenation of bounded repeats against the whole string. Tracks
+// every position each term can end at, so it never backtracks.
+template<size_t N>
+bool matchesSequence(const std::array<Repeat, N>& terms, std::string_view str) {
+    if (str.size() >= 64) {
+        return false; // longer than any sequence pattern allows
+    }
+
+    uint64_t reachable = 1; // bit p: a prefix of length p matched so far
+    for (const Repeat& term : terms) {
+        uint64_t next = 0;
+        for (size_t start = 0; start <= str.size(); start++) {
+            if (!((reachable >> start) & 1)) {
+                continue;
+            }
+            size_t pos = start;
+            for (int count = 0; count <= term.max; count++) {
+                if (count >= term.min) {
+                    next |= uint64_t{1} << pos;
+                }
+                if (pos == str.size() || !term.chars.contains(str[pos])) {
+                    break;
+                }
+                pos++;
+            }
+        }
+        reachable = next;
+        if (reachable == 0) {
+            return false;
+        }
+    }
+    return (reachable >> str.size()) & 1;
+}
+
+constexpr CharClass EMAIL_LOCAL(R"(a-zA-Z0-9._%+-)");
+constexpr CharClass EMAIL_DOMAIN(R"(a-zA-Z0-9.-)");
+constexpr CharClass LETTERS(R"(a-zA-Z)");
+constexpr CharClass DIGITS(R"(0-9)");
+constexpr CharClass NAME(R"(a-zA-Z\s\-'\.)");
+constexpr CharClass ID_NUMBER(R"(a-zA-Z0-9\-)");
+constexpr CharClass POSTAL_CODE(R"(a-zA-Z0-9\s\-)");
+constexpr CharClass TRANSACTION_ID(R"(a-zA-Z0-9\-_)");
+constexpr CharClass BOOKING_REFERENCE(R"(A-Z0-9\-)");
+
+// ^[\+]?[(]?[0-9]{1,4}[)]?[-\s\.]?[(]?[0-9]{1,4}[)]?[-\s\.]?[0-9]{1,9}$
+constexpr CharClass PHONE_SEPARATOR(R"(-\s\.)");
+constexpr std::array<Repeat, 10> PHONE = {{
+    {CharClass("+"), 0, 1},
+    {CharClass("("), 0, 1},
+    {DIGITS, 1, 4},
+    {CharClass(")"), 0, 1},
+    {PHONE_SEPARATOR, 0, 1},
+    {CharClass("("), 0, 1},
+    {DIGITS, 1, 4},
+    {CharClass(")"), 0, 1},
+    {PHONE_SEPARATOR, 0, 1},
+    {DIGITS, 1, 9},
+}};
+
+static_assert(NAME.contains('\'') && NAME.contains('\t') && !NAME.contains('0'));
+static_assert(TRANSACTION_ID.contains('-') && TRANSACTION_ID.contains('_') && !TRANSACTION_ID.contains('.'));
+static_assert(EMAIL_LOCAL.contains('%') && EMAIL_LOCAL.contains('-') && !EMAIL_LOCAL.contains('@'));
+
+} // namespace
+
 bool Validators::isValidEmail(const std::string& email) {
-    // Simplified RFC 5322 email regex
-    const std::string pattern = R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)";
-    return matchesPattern(email, pattern);
+    // ^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$ (simplified RFC 5322)
+    size_t at = email.find('@');
+    if (at == std::string::npos || !EMAIL_LOCAL.containsAll(std::string_view(email).substr(0, at))) {
+        return false;
+    }
+
+    // The domain's characters include '.', so only the last dot can start
+    // the letters-only top-level domain
+    std::string_view domain = std::string_view(email).substr(at + 1);
+    size_t dot = domain.rfind('.');
+    if (dot == std::string_view::npos || dot == 0 || domain.size() - dot - 1 < 2) {
+        return false;
+    }
+    return EMAIL_DOMAIN.containsAll(domain.substr(0, dot)) && LETTERS.containsAll(domain.substr(dot + 1));
 }
 
 bool Validators::isValidPhone(const std::string& phone) {
     // International phone format: +[country code]-[number] or just digits with optional spaces/dashes
-    const std::string pattern = R"(^[\+]?[(]?[0-9]{1,4}[)]?[-\s\.]?[(]?[0-9]{1,4}[)]?[-\s\.]?[0-9]{1,9}$)";
-    return matchesPattern(phone, pattern);
+    return matchesSequence(PHONE, phone);
 }
 
 bool Validators::isValidPrice(double price) {
@@ -44,8 +182,7 @@ bool Validators::isValidName(const std::string& name) {
     }
 
     // Allow letters, spaces, hyphens, apostrophes
-    const std::string pattern = R"(^[a-zA-Z\s\-'\.]+$)";
-    return matchesPattern(name, pattern);
+    return NAME.containsAll(name);
 }
 
 bool Validators::isValidIDNumber(const std::string& idNumber) {
@@ -54,8 +191,7 @@ bool Validators::isValidIDNumber(const std::string& idNumber) {
     }
 
     // Allow alphanumeric and hyphens
-    const std::string pattern = R"(^[a-zA-Z0-9\-]+$)";
-    return matchesPattern(idNumber, pattern);
+    return ID_NUMBER.containsAll(idNumber);
 }
 
 bool Validators::isValidPostalCode(const std::string& postalCode) {
@@ -64,14 +200,23 @@ bool Validators::isValidPostalCode(const std::string& postalCode) {
     }
 
     // Allow alphanumeric, spaces, hyphens
-    const std::string pattern = R"(^[a-zA-Z0-9\s\-]+$)";
-    return matchesPattern(postalCode, pattern);
+    return POSTAL_CODE.containsAll(postalCode);
 }
 
 bool Validators::isValidCurrency(const std::string& amount) {
     // Format: optional sign, digits, optional decimal point with 2 digits
-    const std::string pattern = R"(^[\+\-]?[0-9]+(\.[0-9]{1,2})?$)";
-    return matchesPattern(amount, pattern);
+    // ^[\+\-]?[0-9]+(\.[0-9]{1,2})?$
+    std::string_view rest(amount);
+    if (!rest.empty() && (rest[0] == '+' || rest[0] == '-')) {
+        rest.remove_prefix(1);
+    }
+    size_t dot = rest.find('.');
+    if (dot == std::string_view::npos) {
+        return DIGITS.containsAll(rest);
+    }
+    size_t fraction = rest.size() - dot - 1;
+    return DIGITS.containsAll(rest.substr(0, dot)) && fraction >= 1 && fraction <= 2 &&
+           DIGITS.containsAll(rest.substr(dot + 1));
 }
 
 bool Validators::isValidPercentage(double percentage) {
@@ -222,8 +367,7 @@ bool Validators::isValidTransactionID(const std::string& transactionID) {
     }
 
     // Allow alphanumeric, hyphens, underscores
-    const std::string pattern = R"(^[a-zA-Z0-9\-_]+$)";
-    return matchesPattern(transactionID, pattern);
+    return TRANSACTION_ID.containsAll(transactionID);
 }
 
 bool Validators::isValidBookingReference(const std::string& reference) {
@@ -231,18 +375,8 @@ bool Validators::isValidBookingReference(const std::string& reference) {
         return false;
     }
 
-    // Allow alphanumeric and hyphens
-    const std::string pattern = R"(^[A-Z0-9\-]+$)";
-    return matchesPattern(reference, pattern);
-}
-
-bool Validators::matchesPattern(const std::string& str, const std::string& pattern) {
-    try {
-        std::regex regex(pattern);
-        return std::regex_match(str, regex);
-    } catch (const std::regex_error& e) {
-        return false;
-    }
+    // Allow uppercase alphanumeric and hyphens
+    return BOOKING_REFERENCE.containsAll(reference);
 }
 
 } // namespace HotelManagement
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "utils/Validators.hpp"
+#include <array>
+#include <regex>
+#include <string>
+
+namespace HotelManagement::Legacy {
+
+// The regex-based Validators as they were before the compiled matchers
+// (src/utils/Validators.cpp at 105bf66^), pinned here as the reference for
+// validators_test and the baseline for validators_bench. Do not update these
+// patterns when Validators changes; the test is what catches the difference.
+struct ValidatorRule {
+    const char* name;
+    const char* pattern;
+    size_t maxLength; // empty or longer input is rejected up front; 0 = no check
+    bool (*current)(const std::string&);
+};
+
+inline const std::array<ValidatorRule, 8> VALIDATOR_RULES = {{
+    {"email", R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)", 0, &Validators::isValidEmail},
+    {"phone", R"(^[\+]?[(]?[0-9]{1,4}[)]?[-\s\.]?[(]?[0-9]{1,4}[)]?[-\s\.]?[0-9]{1,9}$)", 0,
+     &Validators::isValidPhone},
+    {"name", R"(^[a-zA-Z\s\-'\.]+$)", 100, &Validators::isValidName},
+    {"idNumber", R"(^[a-zA-Z0-9\-]+$)", 100, &Validators::isValidIDNumber},
+    {"postalCode", R"(^[a-zA-Z0-9\s\-]+$)", 20, &Validators::isValidPostalCode},
+    {"currency", R"(^[\+\-]?[0-9]+(\.[0-9]{1,2})?$)", 0, &Validators::isValidCurrency},
+    {"transactionId", R"(^[a-zA-Z0-9\-_]+$)", 255, &Validators::isValidTransactionID},
+    {"bookingReference", R"(^[A-Z0-9\-]+$)", 50, &Validators::isValidBookingReference},
+}};
+
+inline bool passesLengthCheck(const ValidatorRule& rule, const std::string& str) {
+    return rule.maxLength == 0 || (!str.empty() && str.length() <= rule.maxLength);
+}
+
+// The old Validators::matchesPattern path: the regex is compiled on every call
+inline bool matchesPerCall(const ValidatorRule& rule, const std::string& str) {
+    if (!passesLengthCheck(rule, str)) {
+        return false;
+    }
+    try {
+        std::regex regex(rule.pattern);
+        return std::regex_match(str, regex);
+    } catch (const std::regex_error&) {
+        return false;
+    }
+}
+
+// Same answer as matchesPerCall with a regex compiled once by the caller
+inline bool matchesCompiled(const ValidatorRule& rule, const std::regex& regex, const std::string& str) {
+    return passesLengthCheck(rule, str) && std::regex_match(str, regex);
+}
+
+} // namespace HotelManagement::Legacy
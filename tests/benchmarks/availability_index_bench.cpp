@@ -0,0 +1,285 @@
+// AvailabilityIndex against the SQL it replaces (RoomRepository's prepared
+// availability statements) on a seeded database. Loads room types, rooms and
+// the bookings still holding a room, rebuilds the index, checks both paths
+// give the same answers for random stays, then times them. Not part of
+// ctest.
+//
+//   availability_index_bench [connection string] [stays]
+//
+// Stays start within the next 700 days and last 1-7 nights, so the default
+// 730-day window answers all of them. The batched search runs 64 stays with
+// random room type and occupancy filters, as findAvailableRooms gets them.
+
+#include "database/AvailabilityIndex.hpp"
+#include "utils/DateUtils.hpp"
+#include <libpq-fe.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace HotelManagement;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int HORIZON_DAYS = 730;
+
+constexpr size_t BATCH_SIZE = 64;
+
+struct Stay {
+    int roomId;
+    std::string startDate;
+    std::string endDate;
+};
+
+PGconn* conn = nullptr;
+
+PGresult* expectRows(PGresult* result) {
+    if (PQresultStatus(result) != PGRES_TUPLES_OK && PQresultStatus(result) != PGRES_COMMAND_OK) {
+        std::fprintf(stderr, "availability_index_bench: %s", PQerrorMessage(conn));
+        std::exit(1);
+    }
+    return result;
+}
+
+PGresult* query(const std::string& sql) {
+    return expectRows(PQexec(conn, sql.c_str()));
+}
+
+void prepare(const char* name, const char* sql) {
+    PQclear(expectRows(PQprepare(conn, name, sql, 0, nullptr)));
+}
+
+PGresult* runPrepared(const char* name, const std::vector<std::string>& args) {
+    std::vector<const char*> values;
+    for (const auto& arg : args) {
+        values.push_back(arg.c_str());
+    }
+    return expectRows(PQexecPrepared(conn, name, static_cast<int>(values.size()), values.data(), nullptr, nullptr, 0));
+}
+
+std::vector<int> idColumn(PGresult* result) {
+    std::vector<int> ids;
+    for (int i = 0; i < PQntuples(result); i++) {
+        ids.push_back(std::atoi(PQgetvalue(result, i, 0)));
+    }
+    return ids;
+}
+
+// Rows of the filtered SQL for each query, one statement after another as
+// RoomRepository::findAvailableRoomsInDatabase runs them
+std::vector<std::vector<int>> searchInDatabase(const std::vector<AvailabilityQuery>& queries) {
+    std::vector<std::vector<int>> results;
+    for (const auto& query : queries) {
+        PGresult* result = runPrepared("available_filtered", {query.startDate, query.endDate,
+                                                              std::to_string(query.roomTypeId),
+                                                              std::to_string(query.minOccupancy)});
+        results.push_back(idColumn(result));
+        PQclear(result);
+    }
+    return results;
+}
+
+template<typename F>
+double microsPerCall(int calls, F call) {
+    auto start = Clock::now();
+    for (int i = 0; i < calls; i++) {
+        call(i);
+    }
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / calls;
+}
+
+double millisSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// The rows Application::buildAvailabilityIndex loads through the repositories
+void loadRows(CivilDate today, std::vector<RoomType>& roomTypes, std::vector<Room>& rooms,
+              std::vector<Booking>& bookings) {
+    PGresult* result = query("SELECT id, max_occupancy FROM room_types");
+    for (int i = 0; i < PQntuples(result); i++) {
+        RoomType roomType;
+        roomType.id = std::atoi(PQgetvalue(result, i, 0));
+        roomType.maxOccupancy = std::atoi(PQgetvalue(result, i, 1));
+        roomTypes.push_back(roomType);
+    }
+    PQclear(result);
+
+    result = query("SELECT id, room_number, room_type_id, status FROM rooms");
+    for (int i = 0; i < PQntuples(result); i++) {
+        Room room;
+        room.id = std::atoi(PQgetvalue(result, i, 0));
+        room.roomNumber = PQgetvalue(result, i, 1);
+        room.roomTypeId = std::atoi(PQgetvalue(result, i, 2));
+        room.status = Room::stringToStatus(PQgetvalue(result, i, 3));
+        rooms.push_back(room);
+    }
+    PQclear(result);
+
+    result = query("SELECT id, room_id, check_in_date, check_out_date, status FROM bookings "
+                   "WHERE status NOT IN ('cancelled', 'checked_out') AND check_out_date > '" +
+                   today.toString() + "'");
+    for (int i = 0; i < PQntuples(result); i++) {
+        Booking booking;
+        booking.id = std::atoi(PQgetvalue(result, i, 0));
+        booking.roomId = std::atoi(PQgetvalue(result, i, 1));
+        booking.checkInDate = CivilDate::parse(PQgetvalue(result, i, 2));
+        booking.checkOutDate = CivilDate::parse(PQgetvalue(result, i, 3));
+        booking.status = Booking::stringToStatus(PQgetvalue(result, i, 4));
+        bookings.push_back(booking);
+    }
+    PQclear(result);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string connectionString = argc > 1 ? argv[1] : "dbname=hotel_bench";
+    int stayCount = std::max(argc > 2 ? std::atoi(argv[2]) : 2000, 1);
+
+    conn = PQconnectdb(connectionString.c_str());
+    if (PQstatus(conn) != CONNECTION_OK) {
+        std::fprintf(stderr, "availability_index_bench: %s", PQerrorMessage(conn));
+        return 1;
+    }
+
+    // Same SQL as RoomRepository's IS_AVAILABLE, AVAILABLE_IDS and
+    // AVAILABLE_IDS_FILTERED
+    prepare("is_available", "SELECT COUNT(*) FROM bookings "
+                            "WHERE room_id = $1 "
+                            "AND status NOT IN ('cancelled', 'checked_out') "
+                            "AND (check_in_date, check_out_date) OVERLAPS ($2::date, $3::date)");
+    prepare("available_ids", "SELECT r.id FROM rooms r "
+                             "WHERE r.status = 'available' "
+                             "AND NOT EXISTS ("
+                             "  SELECT 1 FROM bookings b "
+                             "  WHERE b.room_id = r.id "
+                             "  AND b.status NOT IN ('cancelled', 'checked_out') "
+                             "  AND (b.check_in_date, b.check_out_date) OVERLAPS ($1::date, $2::date)"
+                             ")");
+    prepare("available_filtered", "SELECT r.id FROM rooms r "
+                                  "JOIN room_types rt ON rt.id = r.room_type_id "
+                                  "WHERE r.status = 'available' "
+                                  "AND ($3 = 0 OR r.room_type_id = $3) "
+                                  "AND rt.max_occupancy >= $4 "
+                                  "AND NOT EXISTS ("
+                                  "  SELECT 1 FROM bookings b "
+                                  "  WHERE b.room_id = r.id "
+                                  "  AND b.status NOT IN ('cancelled', 'checked_out') "
+                                  "  AND (b.check_in_date, b.check_out_date) OVERLAPS ($1::date, $2::date)"
+                                  ") ORDER BY r.id");
+
+    CivilDate today = DateUtils::getToday();
+    std::vector<RoomType> roomTypes;
+    std::vector<Room> rooms;
+    std::vector<Booking> bookings;
+    auto start = Clock::now();
+    loadRows(today, roomTypes, rooms, bookings);
+    double loadMs = millisSince(start);
+    if (rooms.empty() || roomTypes.empty()) {
+        std::fprintf(stderr, "availability_index_bench: no rooms; seed the database first\n");
+        return 1;
+    }
+
+    AvailabilityIndex index(HORIZON_DAYS);
+    start = Clock::now();
+    index.rebuild(today, roomTypes, rooms, bookings);
+    double rebuildMs = millisSince(start);
+    std::printf("%zu rooms, %zu active bookings; load %.1f ms, rebuild %.1f ms\n", rooms.size(), bookings.size(),
+                loadMs, rebuildMs);
+
+    std::mt19937 rng(42);
+    std::vector<Stay> stays;
+    for (int i = 0; i < stayCount; i++) {
+        int offset = static_cast<int>(rng() % 700);
+        int nights = 1 + static_cast<int>(rng() % 7);
+        stays.push_back({rooms[rng() % rooms.size()].id, (today + offset).toString(),
+                         (today + offset + nights).toString()});
+    }
+
+    // Both paths must agree before the timings mean anything
+    int checks = std::min(stayCount, 300);
+    int mismatches = 0;
+    for (int i = 0; i < checks; i++) {
+        const Stay& stay = stays[i];
+        PGresult* result = runPrepared("is_available", {std::to_string(stay.roomId), stay.startDate, stay.endDate});
+        bool sqlFree = std::atoi(PQgetvalue(result, 0, 0)) == 0;
+        PQclear(result);
+        if (index.isRoomAvailable(stay.roomId, stay.startDate, stay.endDate) != sqlFree) {
+            mismatches++;
+        }
+
+        // The SQL leaves the order open; the index returns ids sorted
+        result = runPrepared("available_ids", {stay.startDate, stay.endDate});
+        std::vector<int> expected = idColumn(result);
+        std::sort(expected.begin(), expected.end());
+        if (index.getAvailableRoomIds(stay.startDate, stay.endDate) != expected) {
+            mismatches++;
+        }
+        PQclear(result);
+    }
+
+    std::vector<AvailabilityQuery> batch;
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        const Stay& stay = stays[i % stays.size()];
+        int roomTypeId = rng() % 2 == 0 ? 0 : roomTypes[rng() % roomTypes.size()].id;
+        batch.push_back({stay.startDate, stay.endDate, roomTypeId, 1 + static_cast<int>(rng() % 4)});
+    }
+    std::vector<std::vector<int>> expectedBatch = searchInDatabase(batch);
+    auto indexBatch = index.findAvailableRooms(batch);
+    for (size_t i = 0; i < batch.size(); i++) {
+        if (indexBatch[i] != expectedBatch[i]) {
+            mismatches++;
+        }
+    }
+    int comparisons = checks * 2 + static_cast<int>(batch.size());
+
+    std::printf("%d mismatches in %d comparisons\n", mismatches, comparisons);
+    if (mismatches > 0) {
+        return 1;
+    }
+
+    double sqlAvailable = microsPerCall(stayCount, [&](int i) {
+        const Stay& stay = stays[i];
+        PQclear(runPrepared("is_available", {std::to_string(stay.roomId), stay.startDate, stay.endDate}));
+    });
+    double indexAvailable = microsPerCall(stayCount * 100, [&](int i) {
+        const Stay& stay = stays[i % stayCount];
+        volatile bool free = index.isRoomAvailable(stay.roomId, stay.startDate, stay.endDate).value_or(false);
+        (void)free;
+    });
+
+    int idCalls = std::min(stayCount, 300);
+    double sqlIds = microsPerCall(idCalls, [&](int i) {
+        const Stay& stay = stays[i];
+        PQclear(runPrepared("available_ids", {stay.startDate, stay.endDate}));
+    });
+    double indexIds = microsPerCall(idCalls * 20, [&](int i) {
+        const Stay& stay = stays[i % idCalls];
+        volatile size_t count = index.getAvailableRoomIds(stay.startDate, stay.endDate)->size();
+        (void)count;
+    });
+
+    double sqlBatch = microsPerCall(3, [&](int) { searchInDatabase(batch); });
+    double indexBatchTime = microsPerCall(500, [&](int) {
+        volatile size_t count = index.findAvailableRooms(batch).size();
+        (void)count;
+    });
+
+    std::printf("%-20s %12s %12s\n", "", "SQL us", "index us");
+    std::printf("%-20s %12.1f %12.3f\n", "isRoomAvailable", sqlAvailable, indexAvailable);
+    std::printf("%-20s %12.1f %12.3f\n", "getAvailableRoomIds", sqlIds, indexIds);
+    std::printf("%-20s %12.1f %12.3f\n", "64-query batch", sqlBatch, indexBatchTime);
+
+    start = Clock::now();
+    index.advanceTo(today + 1);
+    std::printf("advanceTo one day: %.2f ms\n", millisSince(start));
+
+    PQfinish(conn);
+    return 0;
+}
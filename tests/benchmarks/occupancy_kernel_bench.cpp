@@ -0,0 +1,85 @@
+// OccupancyKernel::clearOccupied against the plain word loop it replaced,
+// on random occupancy rows shaped like AvailabilityIndex's: one bit per
+// room, rows padded to OccupancyKernel::WORD_ALIGNMENT, one row per day.
+// Both must leave the same candidate mask. No database needed; not part of
+// ctest.
+//
+//   occupancy_kernel_bench [rooms] [nights]
+
+#include "database/OccupancyKernel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace HotelManagement;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t DAYS = 730;
+constexpr int CALLS = 200000;
+
+volatile uint64_t sink;
+
+void plainLoop(uint64_t* candidates, const uint64_t* rows, size_t words, size_t stride, size_t rowCount) {
+    for (size_t d = 0; d < rowCount; d++) {
+        for (size_t w = 0; w < words; w++) {
+            candidates[w] &= ~rows[d * stride + w];
+        }
+    }
+}
+
+template<typename Kernel>
+double microsPerSearch(std::vector<uint64_t>& candidates, const std::vector<uint64_t>& days, size_t words,
+                       size_t nights, Kernel kernel) {
+    size_t firstDays = DAYS - nights;
+    auto start = Clock::now();
+    for (int i = 0; i < CALLS; i++) {
+        std::fill(candidates.begin(), candidates.end(), ~uint64_t{0});
+        kernel(candidates.data(), days.data() + (i % firstDays) * words, words, words, nights);
+        // Read a different word each time so no search can be dropped
+        sink = sink + candidates[i % words];
+    }
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / CALLS;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t rooms = std::max<size_t>(argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000, 1);
+    size_t nights = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 7;
+    nights = std::clamp<size_t>(nights, 1, DAYS - 1);
+
+    // Same row width rule as AvailabilityIndex
+    size_t words = (rooms + 63) / 64;
+    words = (words + OccupancyKernel::WORD_ALIGNMENT - 1) / OccupancyKernel::WORD_ALIGNMENT *
+            OccupancyKernel::WORD_ALIGNMENT;
+
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> days(words * DAYS);
+    for (auto& word : days) {
+        word = rng();
+    }
+
+    std::vector<uint64_t> fromKernel(words, ~uint64_t{0});
+    std::vector<uint64_t> fromLoop(words, ~uint64_t{0});
+    OccupancyKernel::clearOccupied(fromKernel.data(), days.data(), words, words, nights);
+    plainLoop(fromLoop.data(), days.data(), words, words, nights);
+    if (fromKernel != fromLoop) {
+        std::fprintf(stderr, "occupancy_kernel_bench: kernel and plain loop disagree\n");
+        return 1;
+    }
+
+    std::vector<uint64_t> candidates(words);
+    double kernel = microsPerSearch(candidates, days, words, nights, OccupancyKernel::clearOccupied);
+    double plain = microsPerSearch(candidates, days, words, nights, plainLoop);
+    std::printf("%zu rooms (%zu words per day), %zu nights, %s kernel\n", rooms, words, nights,
+                OccupancyKernel::getName());
+    std::printf("kernel %.3f us, plain loop %.3f us per search\n", kernel, plain);
+    return 0;
+}
@@ -0,0 +1,177 @@
+// Prepared statements vs SQL text sent with every call, on the hot
+// repository statements (same SQL as RoomRepository, GuestRepository and
+// BookingRepository prepare). Uses libpq directly: pqxx's exec_params maps
+// to PQexecParams and exec_prepared to PQexecPrepared. checkIn runs inside
+// BEGIN/ROLLBACK, as executeTransaction would, so the data is left as it
+// was. Server CPU per call is read from /proc and only shown when the
+// server runs on this Linux host. Not part of ctest.
+//
+//   prepared_statements_bench [connection string] [calls per statement]
+//
+// Expects a seeded database (rooms, guests and bookings with ids from 1).
+
+#include <libpq-fe.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Statement {
+    const char* name;
+    const char* sql;
+    int paramCount;
+    bool inTransaction;
+};
+
+const std::vector<Statement> STATEMENTS = {
+    {"room findById",
+     "SELECT id, room_number, room_type_id, floor_number, status, notes, created_at, updated_at "
+     "FROM rooms WHERE id = $1",
+     1, false},
+    {"guest findById",
+     "SELECT id, first_name, last_name, email, phone, address, id_type, id_number, date_of_birth, "
+     "nationality, preferences::text, vip_status, created_at, updated_at FROM guests WHERE id = $1",
+     1, false},
+    {"isRoomAvailable",
+     "SELECT COUNT(*) FROM bookings WHERE room_id = $1 AND status NOT IN ('cancelled', 'checked_out') "
+     "AND (check_in_date, check_out_date) OVERLAPS ($2::date, $3::date)",
+     3, false},
+    {"checkIn", "UPDATE bookings SET status = 'checked_in', actual_check_in = $1 WHERE id = $2", 2, true},
+};
+
+void check(PGconn* conn, PGresult* result) {
+    ExecStatusType status = PQresultStatus(result);
+    PQclear(result);
+    if (status != PGRES_TUPLES_OK && status != PGRES_COMMAND_OK) {
+        std::fprintf(stderr, "prepared_statements_bench: %s", PQerrorMessage(conn));
+        std::exit(1);
+    }
+}
+
+int queryInt(PGconn* conn, const char* sql) {
+    PGresult* result = PQexec(conn, sql);
+    int value = PQresultStatus(result) == PGRES_TUPLES_OK ? std::atoi(PQgetvalue(result, 0, 0)) : 0;
+    PQclear(result);
+    return value;
+}
+
+// utime + stime of a local backend in ms, or -1 when /proc has no such process
+double backendCpuMillis(int pid) {
+    std::ifstream in("/proc/" + std::to_string(pid) + "/stat");
+    std::string stat((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    size_t pos = stat.rfind(')');
+    if (pos == std::string::npos) {
+        return -1.0;
+    }
+
+    // Fields after the command name: state is field 3, utime 14, stime 15
+    std::vector<std::string> fields;
+    for (size_t start = pos + 2; start < stat.size();) {
+        size_t end = std::min(stat.find(' ', start), stat.size());
+        fields.push_back(stat.substr(start, end - start));
+        start = end + 1;
+    }
+    if (fields.size() < 13) {
+        return -1.0;
+    }
+    long ticks = std::stol(fields[11]) + std::stol(fields[12]);
+    return ticks * 1000.0 / static_cast<double>(sysconf(_SC_CLK_TCK));
+}
+
+// Arguments for call i, spread over the seeded ids
+std::vector<std::string> arguments(size_t statement, int i, int rooms, int guests, int bookings) {
+    switch (statement) {
+    case 0:
+        return {std::to_string(1 + (i * 7919) % rooms)};
+    case 1:
+        return {std::to_string(1 + (i * 7919) % guests)};
+    case 2:
+        return {std::to_string(1 + (i * 7919) % rooms), "2027-03-" + std::to_string(10 + i % 15),
+                "2027-03-" + std::to_string(12 + i % 15)};
+    default:
+        return {"2026-10-16 12:00:00", std::to_string(1 + (i * 7919) % bookings)};
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string connectionString = argc > 1 ? argv[1] : "dbname=hotel_bench";
+    int calls = std::max(argc > 2 ? std::atoi(argv[2]) : 20000, 1);
+
+    PGconn* conn = PQconnectdb(connectionString.c_str());
+    if (PQstatus(conn) != CONNECTION_OK) {
+        std::fprintf(stderr, "prepared_statements_bench: %s", PQerrorMessage(conn));
+        return 1;
+    }
+
+    int backendPid = PQbackendPID(conn);
+    int rooms = std::max(queryInt(conn, "SELECT COALESCE(MAX(id), 1) FROM rooms"), 1);
+    int guests = std::max(queryInt(conn, "SELECT COALESCE(MAX(id), 1) FROM guests"), 1);
+    int bookings = std::max(queryInt(conn, "SELECT COALESCE(MAX(id), 1) FROM bookings"), 1);
+
+    for (size_t s = 0; s < STATEMENTS.size(); s++) {
+        std::string name = "bench_" + std::to_string(s);
+        check(conn, PQprepare(conn, name.c_str(), STATEMENTS[s].sql, STATEMENTS[s].paramCount, nullptr));
+    }
+
+    std::printf("%-16s %-9s %9s %9s %9s %15s\n", "statement", "mode", "mean us", "p50 us", "p99 us", "server us/call");
+    for (size_t s = 0; s < STATEMENTS.size(); s++) {
+        const Statement& statement = STATEMENTS[s];
+        std::string name = "bench_" + std::to_string(s);
+
+        for (bool prepared : {false, true}) {
+            std::vector<double> latencies;
+            latencies.reserve(calls);
+            double cpuBefore = backendCpuMillis(backendPid);
+
+            for (int i = 0; i < calls; i++) {
+                std::vector<std::string> args = arguments(s, i, rooms, guests, bookings);
+                std::vector<const char*> values;
+                for (const auto& arg : args) {
+                    values.push_back(arg.c_str());
+                }
+
+                auto start = Clock::now();
+                if (statement.inTransaction) {
+                    check(conn, PQexec(conn, "BEGIN"));
+                }
+                check(conn, prepared ? PQexecPrepared(conn, name.c_str(), statement.paramCount, values.data(),
+                                                      nullptr, nullptr, 0)
+                                     : PQexecParams(conn, statement.sql, statement.paramCount, nullptr,
+                                                    values.data(), nullptr, nullptr, 0));
+                if (statement.inTransaction) {
+                    check(conn, PQexec(conn, "ROLLBACK"));
+                }
+                latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+            }
+
+            double cpuAfter = backendCpuMillis(backendPid);
+            std::sort(latencies.begin(), latencies.end());
+            double mean = 0.0;
+            for (double latency : latencies) {
+                mean += latency;
+            }
+            mean /= static_cast<double>(std::max<size_t>(latencies.size(), 1));
+
+            char serverCpu[32] = "n/a";
+            if (cpuBefore >= 0.0 && cpuAfter >= 0.0) {
+                std::snprintf(serverCpu, sizeof(serverCpu), "%.1f", (cpuAfter - cpuBefore) * 1000.0 / calls);
+            }
+            std::printf("%-16s %-9s %9.1f %9.1f %9.1f %15s\n", statement.name, prepared ? "prepared" : "params",
+                        mean, latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100], serverCpu);
+        }
+    }
+
+    PQfinish(conn);
+    return 0;
+}
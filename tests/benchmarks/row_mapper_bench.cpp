@@ -0,0 +1,167 @@
+// Booking row decoding over one synthetic result of N rows (default 1M,
+// generated server-side with generate_series), three ways:
+//   by name     - the mapper before TableSchema: row["col"], as<std::string>()
+//                 and a compare chain for the status
+//   by position - the same decoding with fields bound by column position
+//   current     - BookingRepository::rowToBooking: positions, FieldReader
+//                 and EnumDecoder
+// Only decoding is timed; the result is fetched once beforehand. Every row
+// must decode to the same Booking all three ways. Not part of ctest.
+//
+//   row_mapper_bench [connection string] [rows]
+
+#include "database/repositories/BookingRepository.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <vector>
+#include <pqxx/pqxx>
+
+using namespace HotelManagement;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Columns in the bookings select-list order that rowToBooking expects
+const char* SYNTHETIC_BOOKINGS = R"(
+    SELECT g AS id,
+           1 + g % 20000 AS guest_id,
+           1 + g % 2000 AS room_id,
+           DATE '2025-01-01' + g % 730 AS check_in_date,
+           DATE '2025-01-01' + g % 730 + 1 + g % 3 AS check_out_date,
+           CASE WHEN g % 3 = 0 THEN TIMESTAMP '2025-01-01 14:05:00' + make_interval(days => g % 730) END
+               AS actual_check_in,
+           CASE WHEN g % 6 = 0 THEN TIMESTAMP '2025-01-02 10:40:00' + make_interval(days => g % 730) END
+               AS actual_check_out,
+           1 + g % 3 AS num_adults,
+           g % 2 AS num_children,
+           (ARRAY['pending', 'confirmed', 'checked_in', 'checked_out', 'cancelled'])[1 + g % 5] AS status,
+           CASE WHEN g % 10 = 0 THEN 'Late arrival, quiet room please' END AS special_requests,
+           (80 + g % 400)::numeric(10, 2) AS total_amount,
+           TIMESTAMP '2024-12-01 09:30:00' + make_interval(secs => g) AS created_at,
+           TIMESTAMP '2024-12-01 09:30:00' + make_interval(secs => g) AS updated_at
+    FROM generate_series(1, $1::int) AS g)";
+
+// Booking::stringToStatus before EnumDecoder
+BookingStatus legacyStatus(const std::string& statusStr) {
+    if (statusStr == "pending") return BookingStatus::Pending;
+    if (statusStr == "confirmed") return BookingStatus::Confirmed;
+    if (statusStr == "checked_in") return BookingStatus::CheckedIn;
+    if (statusStr == "checked_out") return BookingStatus::CheckedOut;
+    if (statusStr == "cancelled") return BookingStatus::Cancelled;
+    return BookingStatus::Pending;
+}
+
+CivilDate legacyDate(const pqxx::field& field) {
+    if (field.is_null()) {
+        return CivilDate();
+    }
+    return CivilDate::parse(std::string_view(field.c_str(), field.size()));
+}
+
+// BookingRepository::rowToBooking before TableSchema (d21f334^)
+Booking byName(const pqxx::row& row) {
+    Booking booking;
+    booking.id = row["id"].as<int>();
+    booking.guestId = row["guest_id"].as<int>();
+    booking.roomId = row["room_id"].as<int>();
+    booking.checkInDate = legacyDate(row["check_in_date"]);
+    booking.checkOutDate = legacyDate(row["check_out_date"]);
+    booking.actualCheckIn = row["actual_check_in"].is_null() ? "" : row["actual_check_in"].as<std::string>();
+    booking.actualCheckOut = row["actual_check_out"].is_null() ? "" : row["actual_check_out"].as<std::string>();
+    booking.numAdults = row["num_adults"].as<int>();
+    booking.numChildren = row["num_children"].as<int>();
+    booking.status = legacyStatus(row["status"].as<std::string>());
+    booking.specialRequests = row["special_requests"].is_null() ? "" : row["special_requests"].as<std::string>();
+    booking.totalAmount = row["total_amount"].is_null() ? 0.0 : row["total_amount"].as<double>();
+    booking.createdAt = row["created_at"].as<std::string>();
+    booking.updatedAt = row["updated_at"].as<std::string>();
+    return booking;
+}
+
+// The same decoding with the name lookups replaced by positions, to split
+// the gain between index binding and FieldReader/EnumDecoder
+Booking byPosition(const pqxx::row& row) {
+    Booking booking;
+    booking.id = row[0].as<int>();
+    booking.guestId = row[1].as<int>();
+    booking.roomId = row[2].as<int>();
+    booking.checkInDate = legacyDate(row[3]);
+    booking.checkOutDate = legacyDate(row[4]);
+    booking.actualCheckIn = row[5].is_null() ? "" : row[5].as<std::string>();
+    booking.actualCheckOut = row[6].is_null() ? "" : row[6].as<std::string>();
+    booking.numAdults = row[7].as<int>();
+    booking.numChildren = row[8].as<int>();
+    booking.status = legacyStatus(row[9].as<std::string>());
+    booking.specialRequests = row[10].is_null() ? "" : row[10].as<std::string>();
+    booking.totalAmount = row[11].is_null() ? 0.0 : row[11].as<double>();
+    booking.createdAt = row[12].as<std::string>();
+    booking.updatedAt = row[13].as<std::string>();
+    return booking;
+}
+
+// Best of several passes, each decoding every row into a vector the way
+// findAll/loadAll do
+template<typename Mapper>
+double decodeMillis(const pqxx::result& result, Mapper mapper, int passes) {
+    double best = 0.0;
+    for (int pass = 0; pass < passes; pass++) {
+        std::vector<Booking> bookings;
+        bookings.reserve(result.size());
+        auto start = Clock::now();
+        for (const auto& row : result) {
+            bookings.push_back(mapper(row));
+        }
+        double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        best = pass == 0 ? elapsed : std::min(best, elapsed);
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string connectionString = argc > 1 ? argv[1] : "dbname=hotel_bench";
+    long rows = argc > 2 ? std::atol(argv[2]) : 1000000;
+    constexpr int PASSES = 5;
+
+    try {
+        pqxx::connection conn(connectionString);
+        pqxx::nontransaction txn(conn);
+
+        auto start = Clock::now();
+        pqxx::result result = txn.exec_params(SYNTHETIC_BOOKINGS, rows);
+        double fetchMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::printf("%ld synthetic booking rows fetched in %.0f ms\n", static_cast<long>(result.size()), fetchMs);
+
+        size_t mismatches = 0;
+        for (const auto& row : result) {
+            Booking current = BookingRepository::rowToBooking(row);
+            if (!(byName(row) == current) || !(byPosition(row) == current)) {
+                mismatches++;
+            }
+        }
+        if (mismatches > 0) {
+            std::fprintf(stderr, "%zu rows decode differently; column order out of date?\n", mismatches);
+            return 1;
+        }
+
+        double nameMs = decodeMillis(result, byName, PASSES);
+        double positionMs = decodeMillis(result, byPosition, PASSES);
+        double currentMs = decodeMillis(result, &BookingRepository::rowToBooking, PASSES);
+
+        double perRow = 1e6 / static_cast<double>(std::max<size_t>(result.size(), 1));
+        std::printf("%-12s %10s %10s\n", "mapper", "ms", "ns/row");
+        std::printf("%-12s %10.1f %10.1f\n", "by name", nameMs, nameMs * perRow);
+        std::printf("%-12s %10.1f %10.1f\n", "by position", positionMs, positionMs * perRow);
+        std::printf("%-12s %10.1f %10.1f\n", "current", currentMs, currentMs * perRow);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "row_mapper_bench: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,63 @@
+// Per-call cost of each validator: the compiled matchers in Validators
+// against the former regex-per-call implementation (LegacyValidators.hpp).
+// Not part of ctest; run by hand from a Release build.
+//
+//   validators_bench [matcher iterations]
+
+#include "../LegacyValidators.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace HotelManagement;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// One accepted and one rejected input per validator, in VALIDATOR_RULES order
+const std::vector<std::vector<std::string>> INPUTS = {
+    {"guest.name+tag@mail.example.com", "guest.name@mail.example.c0m"},
+    {"+44 (20) 7946 0958", "+44 (20) 7946 0958 ext 12"},
+    {"Anne-Marie O'Brien", "Anne-Marie O'Brien 3rd"},
+    {"P-123456789", "P 123456789"},
+    {"SW1A 1AA", "SW1A_1AA"},
+    {"-1234.50", "1234.505"},
+    {"TXN-2024_000123", "TXN-2024.000123"},
+    {"BK-2024-000123", "bk-2024-000123"},
+};
+
+volatile bool sink;
+
+template<typename F>
+double nanosPerCall(int iterations, const std::vector<std::string>& inputs, F validate) {
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (const auto& input : inputs) {
+            sink = validate(input);
+        }
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return elapsed / (static_cast<double>(iterations) * inputs.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    // Building a std::regex costs microseconds; fewer rounds give the same precision
+    int legacyIterations = std::max(iterations / 1000, 10);
+
+    std::printf("%-18s %14s %15s %9s\n", "validator", "regex ns/call", "matcher ns/call", "speedup");
+    for (size_t i = 0; i < Legacy::VALIDATOR_RULES.size(); i++) {
+        const auto& rule = Legacy::VALIDATOR_RULES[i];
+        double legacy = nanosPerCall(legacyIterations, INPUTS[i],
+                                     [&](const std::string& input) { return Legacy::matchesPerCall(rule, input); });
+        double current = nanosPerCall(iterations, INPUTS[i], rule.current);
+        std::printf("%-18s %14.1f %15.1f %8.0fx\n", rule.name, legacy, current, legacy / current);
+    }
+    return 0;
+}
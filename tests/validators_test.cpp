@@ -0,0 +1,114 @@
+// Differential test: every Validators matcher must accept exactly what its
+// former std::regex accepted (LegacyValidators.hpp). Runs hand-picked edge
+// cases plus random strings built from the characters the patterns care
+// about. Exit status is 0 when both agree on every input.
+//
+//   validators_test [random strings per validator]
+
+#include "LegacyValidators.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace HotelManagement;
+
+namespace {
+
+const std::vector<std::string> EDGE_CASES = {
+    "", " ", "a", "-", ".", "_", "'", "@", "+", "()", "\t", "\n", "\v", "\f", "\r", "\xA0", "\x85",
+    "guest@example.com", "a.b-c_d%e+f@mail.example.co", "a@b.c", "a@.com", "@example.com", "a@example.",
+    "a@example.c0m", "a@@example.com", "a@example..com", "a@ex_ample.com", "A@B.CD",
+    "+1 555 1234567", "+44 (20) 7946 0958", "(555)-123-4567", "555.123.4567", "12345", "1", "+", "(1)",
+    "1234567890123456789", "+12345-1234-123456789", "+(1)(2)3", "1--2", "1 2 3", "1\t2\v3",
+    "O'Brien", "Anne-Marie", "J. R. R.", "Zoë", "Smith2", std::string(100, 'a'), std::string(101, 'a'),
+    "AB-1234", "ab_12", std::string(20, '9'), std::string(21, '9'), "SW1A 1AA", "10115", "K1A-0B1",
+    "0", "+0", "-12.5", "12.", ".5", "12.345", "+-1", "1.2.3", "007.00",
+    "TXN-2024_0001", std::string(255, 'x'), std::string(256, 'x'), "BK-2024-0001", "bk-2024-0001",
+    std::string(50, 'A'), std::string(51, 'A'),
+};
+
+// Pieces that build strings near the accept/reject boundary of the patterns
+const std::vector<std::string> TOKENS = {
+    "@", ".", "com", "co", "+", "-", "_", "%", "'", "(", ")", " ", "\t", "\n", "\v", "\f", "\r",
+    "\xA0", "\xE9", "0", "12", "555", "1234", "123456789", "a", "Zq", "BK", "x.y", "..", "@@",
+};
+
+// Mostly valid email characters, for the parts around '@'
+const std::vector<std::string> EMAIL_TOKENS = {
+    "a", "Zq", "com", "co", "x.y", ".", "-", "_", "%", "+", "12", "0", "@", " ",
+};
+
+std::string randomPieces(std::mt19937& rng, const std::vector<std::string>& tokens, int maxPieces) {
+    std::string str;
+    int pieces = static_cast<int>(rng() % (maxPieces + 1));
+    for (int i = 0; i < pieces; i++) {
+        if (rng() % 8 == 0) {
+            str += static_cast<char>(rng() % 256);
+        } else {
+            str += tokens[rng() % tokens.size()];
+        }
+    }
+    return str;
+}
+
+std::string randomString(std::mt19937& rng) {
+    // Every fourth string is email-shaped so the email pattern gets accepts too
+    if (rng() % 4 == 0) {
+        return randomPieces(rng, EMAIL_TOKENS, 3) + "@" + randomPieces(rng, EMAIL_TOKENS, 3) + "." +
+               randomPieces(rng, EMAIL_TOKENS, 2);
+    }
+    return randomPieces(rng, TOKENS, 8);
+}
+
+std::string printable(const std::string& str) {
+    std::string out;
+    for (unsigned char c : str) {
+        if (c >= 32 && c < 127) {
+            out += static_cast<char>(c);
+        } else {
+            char hex[8];
+            std::snprintf(hex, sizeof(hex), "\\x%02X", c);
+            out += hex;
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int randomCount = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+    std::mt19937 rng(20240613);
+    std::vector<std::string> inputs = EDGE_CASES;
+    for (int i = 0; i < randomCount; i++) {
+        inputs.push_back(randomString(rng));
+    }
+
+    int failures = 0;
+    for (const auto& rule : Legacy::VALIDATOR_RULES) {
+        std::regex regex(rule.pattern);
+        size_t accepted = 0;
+        for (const auto& input : inputs) {
+            bool expected = Legacy::matchesCompiled(rule, regex, input);
+            bool actual = rule.current(input);
+            accepted += expected;
+            if (expected != actual) {
+                failures++;
+                std::cerr << rule.name << ": \"" << printable(input) << "\" regex " << expected << ", matcher "
+                          << actual << "\n";
+            }
+        }
+        std::cout << rule.name << ": " << inputs.size() << " inputs, " << accepted << " accepted\n";
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " mismatches\n";
+        return 1;
+    }
+    std::cout << "no mismatches\n";
+    return 0;
+}